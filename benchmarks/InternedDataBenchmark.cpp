@@ -0,0 +1,153 @@
+/*
+Memory footprint of SinglyNodes with owned data compared to nodes with data interned in a StringPool.
+
+As reference, 'EmbeddedStringNode' has the fields of a SinglyNode without the interned mode:
+the data is an embedded std::string member (short strings are stored in the string's own buffer).
+Owned SinglyNodes keep their data inline as well, so they should cost exactly the same.
+
+Usage: InternedDataBenchmark [number of nodes] [number of distinct strings]   (default: 1000000 1000)
+
+Heap usage is measured by counting the bytes requested through the global operator new,
+including the node storage itself (all nodes of a run are kept in one std::vector; linking
+them into a list allocates nothing, so they are not linked).
+Two payloads are measured: short keys that fit into the small string buffer of std::string
+(at most 15 characters with libstdc++) and long names that need a heap buffer of their own.
+*/
+
+#include <cstddef>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <new>
+#include <string>
+#include <vector>
+#include "single/SinglyNode.h"
+#include "single/StringPool.h"
+
+static std::size_t allocated_bytes = 0;
+
+void *operator new(std::size_t size)
+{
+    allocated_bytes += size;
+
+    if (void *memory = std::malloc(size))
+        return memory;
+
+    throw std::bad_alloc();
+}
+
+void operator delete(void *memory) noexcept
+{
+    std::free(memory);
+}
+
+void operator delete(void *memory, std::size_t) noexcept
+{
+    std::free(memory);
+}
+
+// Node layout of a SinglyNode without the interned mode
+struct EmbeddedStringNode
+{
+    int index;
+    int access_count;
+    std::string data;
+    EmbeddedStringNode *next_node_ptr;
+    bool in_list;
+};
+
+// Returns the distinct strings of a payload; they are created before measuring, so no temporary strings are counted
+std::vector<std::string> make_short_keys(int distinct_count)
+{
+    std::vector<std::string> keys;
+    for (int i = 0; i < distinct_count; i++)
+        keys.push_back("key-" + std::to_string(i));
+
+    return keys;
+}
+
+std::vector<std::string> make_long_names(int distinct_count)
+{
+    std::vector<std::string> names;
+    for (int i = 0; i < distinct_count; i++)
+        names.push_back("Customer account holder no. " + std::to_string(i));
+
+    return names;
+}
+
+std::size_t measure_embedded(int node_count, const std::vector<std::string> &distinct_data)
+{
+    std::size_t bytes_before = allocated_bytes;
+
+    std::vector<EmbeddedStringNode> nodes;
+    nodes.reserve(node_count);
+    for (int i = 0; i < node_count; i++)
+        nodes.push_back(EmbeddedStringNode{i, 0, distinct_data[i % distinct_data.size()], nullptr, false});
+
+    return allocated_bytes - bytes_before;
+}
+
+std::size_t measure_owned(int node_count, const std::vector<std::string> &distinct_data)
+{
+    std::size_t bytes_before = allocated_bytes;
+
+    std::vector<SinglyNode> nodes;
+    nodes.reserve(node_count);
+    for (int i = 0; i < node_count; i++)
+        nodes.emplace_back(distinct_data[i % distinct_data.size()]);
+
+    return allocated_bytes - bytes_before;
+}
+
+std::size_t measure_interned(int node_count, const std::vector<std::string> &distinct_data)
+{
+    std::size_t bytes_before = allocated_bytes;
+
+    StringPool pool; // Counted as well
+    std::vector<SinglyNode> nodes;
+    nodes.reserve(node_count);
+    for (int i = 0; i < node_count; i++)
+        nodes.emplace_back(pool, distinct_data[i % distinct_data.size()]);
+
+    return allocated_bytes - bytes_before;
+}
+
+void print_row(const std::string &name, std::size_t bytes, int node_count)
+{
+    std::cout << std::left << std::setw(24) << name << std::right
+              << std::setw(14) << bytes
+              << std::setw(14) << std::fixed << std::setprecision(1) << static_cast<double>(bytes) / node_count << std::endl;
+}
+
+void measure_payload(const std::string &title, int node_count, const std::vector<std::string> &distinct_data)
+{
+    std::cout << title << " (e.g. '" << distinct_data.front() << "')\n";
+    std::cout << std::left << std::setw(24) << "Node" << std::right
+              << std::setw(14) << "Heap bytes"
+              << std::setw(14) << "Bytes/node" << std::endl;
+
+    print_row("EmbeddedStringNode", measure_embedded(node_count, distinct_data), node_count);
+    print_row("SinglyNode (owned)", measure_owned(node_count, distinct_data), node_count);
+    print_row("SinglyNode (interned)", measure_interned(node_count, distinct_data), node_count);
+    std::cout << std::endl;
+}
+
+int main(int argc, char **argv)
+{
+    int node_count = argc > 1 ? std::atoi(argv[1]) : 1000000;
+    int distinct_count = argc > 2 ? std::atoi(argv[2]) : 1000;
+    if (node_count <= 0 || distinct_count <= 0)
+    {
+        std::cerr << "Number of nodes and distinct strings must be greater than 0" << std::endl;
+        return 1;
+    }
+
+    std::cout << "===== Interned Data Benchmark (" << node_count << " nodes, " << distinct_count << " distinct strings) =====\n\n";
+    std::cout << "sizeof(SinglyNode) = " << sizeof(SinglyNode) << " bytes, sizeof(EmbeddedStringNode) = "
+              << sizeof(EmbeddedStringNode) << " bytes\n\n";
+
+    measure_payload("Short keys", node_count, make_short_keys(distinct_count));
+    measure_payload("Long names", node_count, make_long_names(distinct_count));
+
+    return 0;
+}
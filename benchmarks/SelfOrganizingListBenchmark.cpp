@@ -0,0 +1,110 @@
+/*
+Average traversal length of SinglyLinkedList::find() for each SelfOrganizingPolicy
+on a Zipf-distributed lookup workload (a few keys are looked up very often).
+
+Usage: SelfOrganizingListBenchmark [number of nodes] [number of lookups] [zipf exponent]
+       (default: 1000 100000 1.0)
+
+The traversal length of a lookup is the position of the found node before the list is reordered
+(0 = head), i.e. the number of nodes find() had to skip.
+*/
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <random>
+#include <string>
+#include <vector>
+#include "single/SinglyLinkedList.h"
+#include "single/SinglyNode.h"
+
+struct Measurement
+{
+    double average_traversal;
+    double milliseconds;
+};
+
+Measurement measure_policy(SelfOrganizingPolicy policy, int node_count, const std::vector<int> &lookups)
+{
+    std::vector<std::unique_ptr<SinglyNode>> nodes;
+    for (int i = 0; i < node_count; i++)
+        nodes.emplace_back(new SinglyNode("key " + std::to_string(i)));
+
+    // Insert the keys in a random order, so the popular keys are not at the head from the start
+    std::vector<int> order(node_count);
+    for (int i = 0; i < node_count; i++)
+        order[i] = i;
+    std::shuffle(order.begin(), order.end(), std::mt19937(42));
+
+    SinglyLinkedList s_list;
+    for (int i : order)
+        s_list.push_back(*nodes[i]);
+
+    s_list.set_self_organizing_policy(policy);
+
+    long long traversed = 0;
+    auto start = std::chrono::steady_clock::now();
+
+    for (int key : lookups)
+    {
+        traversed += nodes[key]->get_index(); // Position before the lookup
+        s_list.find(nodes[key]->get_data_view());
+    }
+
+    auto stop = std::chrono::steady_clock::now();
+
+    return Measurement{static_cast<double>(traversed) / lookups.size(),
+                       std::chrono::duration<double, std::milli>(stop - start).count()};
+}
+
+int main(int argc, char **argv)
+{
+    int node_count = argc > 1 ? std::atoi(argv[1]) : 1000;
+    int lookup_count = argc > 2 ? std::atoi(argv[2]) : 100000;
+    double exponent = argc > 3 ? std::atof(argv[3]) : 1.0;
+
+    if (node_count <= 0 || lookup_count <= 0)
+    {
+        std::cerr << "Number of nodes and lookups must be greater than 0" << std::endl;
+        return 1;
+    }
+
+    // Zipf distribution: the key with rank k is looked up with a probability proportional to 1 / k^exponent
+    std::vector<double> weights(node_count);
+    for (int k = 0; k < node_count; k++)
+        weights[k] = 1.0 / std::pow(k + 1, exponent);
+
+    std::mt19937 generator(7);
+    std::discrete_distribution<int> zipf(weights.begin(), weights.end());
+
+    std::vector<int> lookups(lookup_count);
+    for (int &key : lookups)
+        key = zipf(generator);
+
+    std::cout << "===== Self-Organizing List Benchmark (" << node_count << " nodes, " << lookup_count
+              << " lookups, zipf exponent " << exponent << ") =====\n\n";
+    std::cout << std::left << std::setw(14) << "Policy" << std::right
+              << std::setw(20) << "Avg. traversal"
+              << std::setw(14) << "Time ms" << std::endl;
+
+    const std::pair<SelfOrganizingPolicy, const char *> policies[] = {
+        {SelfOrganizingPolicy::None, "None"},
+        {SelfOrganizingPolicy::MoveToFront, "MoveToFront"},
+        {SelfOrganizingPolicy::Transpose, "Transpose"},
+        {SelfOrganizingPolicy::Count, "Count"}};
+
+    for (const auto &policy : policies)
+    {
+        Measurement measurement = measure_policy(policy.first, node_count, lookups);
+
+        std::cout << std::left << std::setw(14) << policy.second << std::right << std::fixed
+                  << std::setw(20) << std::setprecision(1) << measurement.average_traversal
+                  << std::setw(14) << std::setprecision(2) << measurement.milliseconds << std::endl;
+    }
+
+    return 0;
+}
@@ -0,0 +1,74 @@
+/*
+Append throughput of ShardedSinglyLinkedList with one stripe (all threads contend on one tail)
+compared to one stripe per thread, for an increasing number of threads.
+
+Usage: ShardedSinglyLinkedListBenchmark [nodes per thread]   (default: 200000)
+*/
+
+#include <chrono>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <thread>
+#include <vector>
+#include "single/ShardedSinglyLinkedList.h"
+#include "single/SinglyNode.h"
+
+// Returns the appended nodes per second for 'thread_count' threads appending to a list with 'stripe_count' stripes
+double measure_appends(std::vector<std::unique_ptr<SinglyNode>> &nodes, int thread_count, int nodes_per_thread, std::size_t stripe_count)
+{
+    ShardedSinglyLinkedList sharded_list(stripe_count);
+    std::vector<std::thread> threads;
+
+    auto start = std::chrono::steady_clock::now();
+
+    for (int t = 0; t < thread_count; t++)
+        threads.emplace_back([&, t]
+                             {
+                                 for (int i = 0; i < nodes_per_thread; i++)
+                                     sharded_list.push_back(*nodes[t * nodes_per_thread + i]); });
+
+    for (std::thread &thread : threads)
+        thread.join();
+
+    auto stop = std::chrono::steady_clock::now();
+
+    double seconds = std::chrono::duration<double>(stop - start).count();
+    return thread_count * nodes_per_thread / seconds;
+}
+
+int main(int argc, char **argv)
+{
+    int nodes_per_thread = argc > 1 ? std::atoi(argv[1]) : 200000;
+    if (nodes_per_thread <= 0)
+    {
+        std::cerr << "Number of nodes must be greater than 0" << std::endl;
+        return 1;
+    }
+
+    int max_threads = static_cast<int>(std::thread::hardware_concurrency());
+    if (max_threads < 2)
+        max_threads = 2;
+
+    std::vector<std::unique_ptr<SinglyNode>> nodes;
+    for (int i = 0; i < max_threads * nodes_per_thread; i++)
+        nodes.emplace_back(new SinglyNode("node"));
+
+    std::cout << "===== Sharded Singly Linked List Benchmark (" << nodes_per_thread << " appends per thread) =====\n\n";
+    std::cout << std::setw(10) << "Threads"
+              << std::setw(22) << "1 stripe [M/s]"
+              << std::setw(22) << "1 stripe/thread [M/s]" << std::endl;
+
+    for (int thread_count = 1; thread_count <= max_threads; thread_count *= 2)
+    {
+        double single = measure_appends(nodes, thread_count, nodes_per_thread, 1);
+        double sharded = measure_appends(nodes, thread_count, nodes_per_thread, thread_count);
+
+        std::cout << std::setw(10) << thread_count << std::fixed << std::setprecision(2)
+                  << std::setw(22) << single / 1e6
+                  << std::setw(22) << sharded / 1e6 << std::endl;
+    }
+
+    return 0;
+}
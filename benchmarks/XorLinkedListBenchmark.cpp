@@ -0,0 +1,156 @@
+/*
+Memory footprint and traversal time of the XOR linked list compared to a doubly linked list.
+
+The doubly linked list of this project is not implemented yet, therefore 'std::list<std::string>'
+(two pointers per node, one heap allocation per node) is used as the doubly linked reference.
+
+Usage: XorLinkedListBenchmark [number of nodes]   (default: 1000000)
+
+Heap usage is measured by counting the bytes requested through the global operator new.
+The allocator's own header per allocation (typically 8-16 bytes) comes on top of that,
+which hits the doubly list once per node and the XOR list only once per block of nodes.
+*/
+
+#include <chrono>
+#include <cstddef>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <list>
+#include <new>
+#include <string>
+#include "xor/XorLinkedList.h"
+
+static std::size_t allocated_bytes = 0;
+static std::size_t allocation_count = 0;
+
+void *operator new(std::size_t size)
+{
+    allocated_bytes += size;
+    allocation_count++;
+
+    if (void *memory = std::malloc(size))
+        return memory;
+
+    throw std::bad_alloc();
+}
+
+void operator delete(void *memory) noexcept
+{
+    std::free(memory);
+}
+
+void operator delete(void *memory, std::size_t) noexcept
+{
+    std::free(memory);
+}
+
+struct Measurement
+{
+    std::size_t bytes;
+    std::size_t allocations;
+    double forward_ms;
+    double backward_ms;
+};
+
+template <typename Func>
+double time_ms(Func func)
+{
+    auto start = std::chrono::steady_clock::now();
+    func();
+    auto stop = std::chrono::steady_clock::now();
+
+    return std::chrono::duration<double, std::milli>(stop - start).count();
+}
+
+// Short payloads fit into the small string buffer, so the measured memory is the node overhead only
+std::string make_data(int i)
+{
+    return std::to_string(i % 1000);
+}
+
+Measurement measure_xor_list(int node_count)
+{
+    Measurement result{};
+    std::size_t bytes_before = allocated_bytes;
+    std::size_t allocations_before = allocation_count;
+
+    XorLinkedList x_list;
+    for (int i = 0; i < node_count; i++)
+        x_list.push_back(make_data(i));
+
+    result.bytes = allocated_bytes - bytes_before;
+    result.allocations = allocation_count - allocations_before;
+
+    std::size_t checksum = 0;
+    result.forward_ms = time_ms([&]
+                                { for (auto it = x_list.begin(); it != x_list.end(); ++it) checksum += it->get_data().size(); });
+    result.backward_ms = time_ms([&]
+                                 { for (auto it = x_list.rbegin(); it != x_list.rend(); ++it) checksum += it->get_data().size(); });
+
+    if (checksum == 0)
+        std::cout << "empty list" << std::endl; // Keeps the traversals from being optimized away
+
+    return result;
+}
+
+Measurement measure_doubly_list(int node_count)
+{
+    Measurement result{};
+    std::size_t bytes_before = allocated_bytes;
+    std::size_t allocations_before = allocation_count;
+
+    std::list<std::string> d_list;
+    for (int i = 0; i < node_count; i++)
+        d_list.push_back(make_data(i));
+
+    result.bytes = allocated_bytes - bytes_before;
+    result.allocations = allocation_count - allocations_before;
+
+    std::size_t checksum = 0;
+    result.forward_ms = time_ms([&]
+                                { for (auto it = d_list.begin(); it != d_list.end(); ++it) checksum += std::string(*it).size(); });
+    result.backward_ms = time_ms([&]
+                                 { for (auto it = d_list.rbegin(); it != d_list.rend(); ++it) checksum += std::string(*it).size(); });
+
+    if (checksum == 0)
+        std::cout << "empty list" << std::endl;
+
+    return result;
+}
+
+void print_row(const std::string &name, const Measurement &measurement, int node_count)
+{
+    std::cout << std::left << std::setw(16) << name << std::right
+              << std::setw(14) << measurement.bytes
+              << std::setw(14) << std::fixed << std::setprecision(1) << static_cast<double>(measurement.bytes) / node_count
+              << std::setw(14) << measurement.allocations
+              << std::setw(14) << std::setprecision(2) << measurement.forward_ms
+              << std::setw(14) << measurement.backward_ms << std::endl;
+}
+
+int main(int argc, char **argv)
+{
+    int node_count = argc > 1 ? std::atoi(argv[1]) : 1000000;
+    if (node_count <= 0)
+    {
+        std::cerr << "Number of nodes must be greater than 0" << std::endl;
+        return 1;
+    }
+
+    std::cout << "===== XOR Linked List Benchmark (" << node_count << " nodes) =====\n\n";
+    std::cout << "sizeof(XorNode) = " << sizeof(XorNode) << " bytes, doubly node = "
+              << sizeof(std::string) + 2 * sizeof(void *) << " bytes\n\n";
+
+    std::cout << std::left << std::setw(16) << "List" << std::right
+              << std::setw(14) << "Heap bytes"
+              << std::setw(14) << "Bytes/node"
+              << std::setw(14) << "Allocations"
+              << std::setw(14) << "Forward ms"
+              << std::setw(14) << "Backward ms" << std::endl;
+
+    print_row("XorLinkedList", measure_xor_list(node_count), node_count);
+    print_row("std::list", measure_doubly_list(node_count), node_count);
+
+    return 0;
+}
@@ -0,0 +1,124 @@
+#include "circular/CircularDoublyLinkedList.h"
+
+CircularDoublyLinkedList::CircularDoublyLinkedList()
+{
+    cursor_ptr = nullptr;
+    node_count = 0;
+}
+
+CircularDoublyLinkedList::~CircularDoublyLinkedList()
+{
+    clear(); // Open the ring, so the nodes can be reused in other lists
+}
+
+void CircularDoublyLinkedList::link_between(DoublyNode &new_node, DoublyNode *prev_node_ptr, DoublyNode *next_node_ptr)
+{
+    new_node.set_prev_node_ptr(prev_node_ptr);
+    new_node.set_next_node_ptr(next_node_ptr);
+    prev_node_ptr->set_next_node_ptr(&new_node);
+    next_node_ptr->set_prev_node_ptr(&new_node);
+
+    node_count++;
+}
+
+DoublyNode &CircularDoublyLinkedList::get_current() const
+{
+    if (is_empty())
+        LINKEDLIST_THROW(std::out_of_range("List is empty"));
+
+    return *cursor_ptr;
+}
+
+void CircularDoublyLinkedList::advance(int steps)
+{
+    if (is_empty())
+        return;
+
+    steps %= node_count; // Full rounds end at the same node
+
+    while (steps > 0)
+    {
+        cursor_ptr = cursor_ptr->get_next_node_ptr();
+        steps--;
+    }
+
+    while (steps < 0)
+    {
+        cursor_ptr = cursor_ptr->get_prev_node_ptr();
+        steps++;
+    }
+}
+
+void CircularDoublyLinkedList::insert_before_cursor(DoublyNode &new_node)
+{
+    // A node in a ring always has neighbours, so this O(1) check catches nodes already in this (or another) ring
+    if (new_node.get_next_node_ptr() != nullptr || new_node.get_prev_node_ptr() != nullptr)
+        LINKEDLIST_THROW(std::runtime_error("Node already in a list"));
+
+    if (is_empty())
+    {
+        // A single node is its own neighbour in both directions and is the current node
+        new_node.set_prev_node_ptr(&new_node);
+        new_node.set_next_node_ptr(&new_node);
+        cursor_ptr = &new_node;
+        node_count++;
+        return;
+    }
+
+    link_between(new_node, cursor_ptr->get_prev_node_ptr(), cursor_ptr);
+}
+
+void CircularDoublyLinkedList::insert_after_cursor(DoublyNode &new_node)
+{
+    if (is_empty())
+    {
+        insert_before_cursor(new_node); // Same for a single node
+        return;
+    }
+
+    if (new_node.get_next_node_ptr() != nullptr || new_node.get_prev_node_ptr() != nullptr)
+        LINKEDLIST_THROW(std::runtime_error("Node already in a list"));
+
+    link_between(new_node, cursor_ptr, cursor_ptr->get_next_node_ptr());
+}
+
+DoublyNode &CircularDoublyLinkedList::remove_current()
+{
+    if (is_empty())
+        LINKEDLIST_THROW(std::out_of_range("List is empty"));
+
+    DoublyNode *removed_node = cursor_ptr;
+
+    if (removed_node->get_next_node_ptr() == removed_node)
+    {
+        cursor_ptr = nullptr; // The last node is removed
+    }
+    else
+    {
+        removed_node->get_prev_node_ptr()->set_next_node_ptr(removed_node->get_next_node_ptr());
+        removed_node->get_next_node_ptr()->set_prev_node_ptr(removed_node->get_prev_node_ptr());
+        cursor_ptr = removed_node->get_next_node_ptr(); // The next node becomes the current node
+    }
+
+    removed_node->set_prev_node_ptr(nullptr);
+    removed_node->set_next_node_ptr(nullptr);
+    node_count--;
+
+    return *removed_node;
+}
+
+bool CircularDoublyLinkedList::is_empty() const
+{
+    return cursor_ptr == nullptr;
+}
+
+int CircularDoublyLinkedList::size() const
+{
+    return node_count;
+}
+
+void CircularDoublyLinkedList::clear()
+{
+    while (!is_empty())
+        remove_current();
+}
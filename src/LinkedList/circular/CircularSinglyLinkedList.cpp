@@ -0,0 +1,122 @@
+#include "circular/CircularSinglyLinkedList.h"
+
+CircularSinglyLinkedList::CircularSinglyLinkedList()
+{
+    cursor_prev_ptr = nullptr;
+    node_count = 0;
+}
+
+CircularSinglyLinkedList::~CircularSinglyLinkedList()
+{
+    clear(); // Open the ring, so the nodes can be reused in other lists
+}
+
+SinglyNode &CircularSinglyLinkedList::get_current() const
+{
+    if (is_empty())
+        LINKEDLIST_THROW(std::out_of_range("List is empty"));
+
+    return *cursor_prev_ptr->get_next_node_ptr();
+}
+
+void CircularSinglyLinkedList::advance(int steps)
+{
+    if (is_empty())
+        return;
+
+    // Going backwards in a singly linked ring means going forwards almost one round
+    steps = ((steps % node_count) + node_count) % node_count;
+
+    while (steps > 0)
+    {
+        cursor_prev_ptr = cursor_prev_ptr->get_next_node_ptr();
+        steps--;
+    }
+}
+
+void CircularSinglyLinkedList::insert_before_cursor(SinglyNode &new_node)
+{
+    if (new_node.is_in_list())
+        LINKEDLIST_THROW(std::runtime_error("Node already in a list")); // In this or any other list, checked in O(1)
+
+    new_node.set_in_list(true);
+
+    new_node.set_index(INVALID_INDEX);
+
+    if (is_empty())
+    {
+        // A single node points to itself and is the current node
+        new_node.set_next_node_ptr(&new_node);
+    }
+    else
+    {
+        new_node.set_next_node_ptr(cursor_prev_ptr->get_next_node_ptr());
+        cursor_prev_ptr->set_next_node_ptr(&new_node);
+    }
+
+    // The new node is the one before the current node now
+    cursor_prev_ptr = &new_node;
+    node_count++;
+}
+
+void CircularSinglyLinkedList::insert_after_cursor(SinglyNode &new_node)
+{
+    if (is_empty())
+    {
+        insert_before_cursor(new_node); // Same for a single node
+        return;
+    }
+
+    if (new_node.is_in_list())
+        LINKEDLIST_THROW(std::runtime_error("Node already in a list"));
+
+    new_node.set_in_list(true);
+
+    new_node.set_index(INVALID_INDEX);
+
+    SinglyNode *current_node = cursor_prev_ptr->get_next_node_ptr();
+    new_node.set_next_node_ptr(current_node->get_next_node_ptr());
+    current_node->set_next_node_ptr(&new_node);
+
+    // With a single node the current node is also the node before the cursor; now the new node is
+    if (cursor_prev_ptr == current_node)
+        cursor_prev_ptr = &new_node;
+
+    node_count++;
+}
+
+SinglyNode &CircularSinglyLinkedList::remove_current()
+{
+    if (is_empty())
+        LINKEDLIST_THROW(std::out_of_range("List is empty"));
+
+    SinglyNode *removed_node = cursor_prev_ptr->get_next_node_ptr();
+
+    if (removed_node == cursor_prev_ptr)
+        cursor_prev_ptr = nullptr; // The last node is removed
+    else
+        cursor_prev_ptr->set_next_node_ptr(removed_node->get_next_node_ptr()); // The next node becomes the current node
+
+    removed_node->set_next_node_ptr(nullptr);
+    removed_node->set_in_list(false);
+    removed_node->set_index(INVALID_INDEX);
+    node_count--;
+
+    return *removed_node;
+}
+
+bool CircularSinglyLinkedList::is_empty() const
+{
+    return cursor_prev_ptr == nullptr;
+}
+
+int CircularSinglyLinkedList::size() const
+{
+    return node_count;
+}
+
+void CircularSinglyLinkedList::clear()
+{
+    while (!is_empty())
+        remove_current();
+}
@@ -0,0 +1,55 @@
+#ifndef CIRCULARDOUBLYLINKEDLIST_H
+#define CIRCULARDOUBLYLINKEDLIST_H
+
+/*
+- doubly circular linked list: forwards and backwards, the last node points to the first node and vice versa
+- There is no head or tail, only a cursor to the current node. Advancing in both directions,
+  inserting before or after the cursor and removing the current node are O(1).
+- Like SinglyLinkedList the list does not own its nodes. The node indexes are not used (INVALID_INDEX).
+*/
+
+#include "common/LinkedListErrors.h"
+#include "double/DoublyNode.h"
+
+class CircularDoublyLinkedList
+{
+private:
+    // Pointer to the current node (nullptr if the list is empty)
+    DoublyNode *cursor_ptr;
+
+    // Number of nodes in the ring
+    int node_count;
+
+    // Links the new node between two neighbouring nodes of the ring
+    void link_between(DoublyNode &new_node, DoublyNode *prev_node_ptr, DoublyNode *next_node_ptr);
+
+public:
+    CircularDoublyLinkedList();  // Constructor
+    ~CircularDoublyLinkedList(); // Destructor
+
+    // Returns the node at the cursor
+    DoublyNode &get_current() const;
+
+    // Moves the cursor 'steps' nodes forward (negative steps move it backward)
+    void advance(int steps = 1);
+
+    // Inserts a new node before the cursor, i.e. it becomes the last node of the current round (O(1))
+    void insert_before_cursor(DoublyNode &new_node);
+
+    // Inserts a new node after the cursor, i.e. it is the next node after the current one (O(1))
+    void insert_after_cursor(DoublyNode &new_node);
+
+    // Removes the node at the cursor and returns it; the cursor moves to the next node (O(1))
+    DoublyNode &remove_current();
+
+    // Returns true if the list is empty
+    bool is_empty() const;
+
+    // Returns the number of nodes in the list
+    int size() const;
+
+    // Removes all nodes from the list
+    void clear();
+};
+
+#endif
@@ -0,0 +1,64 @@
+#ifndef CIRCULARSINGLYLINKEDLIST_H
+#define CIRCULARSINGLYLINKEDLIST_H
+
+/*
+- singly circular linked list: forwards only, the last node points back to the first node
+- There is no head or tail, only a cursor to the current node (e.g. the task whose turn it is in a
+  round-robin scheduler). Advancing, inserting before or after the cursor and removing the current node are O(1).
+- To insert before and remove at the cursor without searching, the list stores the node BEFORE the cursor:
+
+  cursor_prev_ptr  current node
+        |               |
+        v               v
+    +---+---+       +---+---+       +---+---+
+    | 3 |  *------->| 1 |  *------->| 2 |  *----+
+    +---+---+       +---+---+       +---+---+    |
+        ^                                         |
+        +-----------------------------------------+
+
+- Like SinglyLinkedList the list does not own its nodes. The node indexes are not used (INVALID_INDEX).
+  A node can be in only one list at a time (linear or circular), which is checked in O(1) with its 'in_list' flag.
+*/
+
+#include "common/LinkedListErrors.h"
+#include "single/SinglyNode.h"
+
+class CircularSinglyLinkedList
+{
+private:
+    // Pointer to the node before the current node (nullptr if the list is empty)
+    SinglyNode *cursor_prev_ptr;
+
+    // Number of nodes in the ring
+    int node_count;
+
+public:
+    CircularSinglyLinkedList();  // Constructor
+    ~CircularSinglyLinkedList(); // Destructor
+
+    // Returns the node at the cursor
+    SinglyNode &get_current() const;
+
+    // Moves the cursor 'steps' nodes forward (negative steps move it backward, which costs up to one round)
+    void advance(int steps = 1);
+
+    // Inserts a new node before the cursor, i.e. it becomes the last node of the current round (O(1))
+    void insert_before_cursor(SinglyNode &new_node);
+
+    // Inserts a new node after the cursor, i.e. it is the next node after the current one (O(1))
+    void insert_after_cursor(SinglyNode &new_node);
+
+    // Removes the node at the cursor and returns it; the cursor moves to the next node (O(1))
+    SinglyNode &remove_current();
+
+    // Returns true if the list is empty
+    bool is_empty() const;
+
+    // Returns the number of nodes in the list
+    int size() const;
+
+    // Removes all nodes from the list
+    void clear();
+};
+
+#endif
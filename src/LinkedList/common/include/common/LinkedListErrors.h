@@ -0,0 +1,29 @@
+#ifndef LINKEDLISTERRORS_H
+#define LINKEDLISTERRORS_H
+
+/*
+Error reporting of the linked list library.
+
+- Default build: errors are reported by throwing the given exception.
+- Build with '-DLINKEDLIST_NO_EXCEPTIONS=ON' (compiled with -fno-exceptions): the exception message is printed
+  to stderr and the program is aborted. Use the non-throwing 'try_...' methods, which report a miss
+  with a nullptr, false or INVALID_INDEX, for every case that can legitimately fail.
+*/
+
+#include <cstdlib>
+#include <iostream>
+#include <stdexcept>
+
+#ifdef LINKEDLIST_NO_EXCEPTIONS
+#define LINKEDLIST_THROW(exception)                              \
+    do                                                           \
+    {                                                            \
+        std::cerr << "LinkedList error: " << (exception).what() \
+                  << std::endl;                                  \
+        std::abort();                                            \
+    } while (false)
+#else
+#define LINKEDLIST_THROW(exception) throw exception
+#endif
+
+#endif
@@ -0,0 +1,53 @@
+#include "double/DoublyNode.h"
+
+DoublyNode::DoublyNode(std::string data)
+{
+    this->data = data;
+    this->index = INVALID_INDEX;
+    this->prev_node_ptr = nullptr;
+    this->next_node_ptr = nullptr;
+}
+
+DoublyNode::~DoublyNode()
+{
+}
+
+int DoublyNode::get_index() const
+{
+    return this->index;
+}
+
+void DoublyNode::set_index(const int &index)
+{
+    this->index = index;
+}
+
+std::string DoublyNode::get_data() const
+{
+    return std::string(this->data);
+}
+
+void DoublyNode::set_data(const std::string &new_data)
+{
+    this->data = new_data;
+}
+
+DoublyNode *DoublyNode::get_prev_node_ptr() const
+{
+    return this->prev_node_ptr;
+}
+
+void DoublyNode::set_prev_node_ptr(DoublyNode *new_prev_node_ptr)
+{
+    this->prev_node_ptr = new_prev_node_ptr;
+}
+
+DoublyNode *DoublyNode::get_next_node_ptr() const
+{
+    return this->next_node_ptr;
+}
+
+void DoublyNode::set_next_node_ptr(DoublyNode *new_next_node_ptr)
+{
+    this->next_node_ptr = new_next_node_ptr;
+}
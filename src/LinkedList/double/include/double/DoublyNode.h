@@ -0,0 +1,40 @@
+#ifndef DOUBLYNODE_H
+#define DOUBLYNODE_H
+
+#include <string>
+
+#define INVALID_INDEX (-1)
+
+class DoublyNode
+{
+private:
+    int index; // Index of the node in the list
+
+    std::string data; // e.g. a Name of a person
+
+    DoublyNode *prev_node_ptr; // Pointer to the previous node in the list.
+
+    DoublyNode *next_node_ptr; // Pointer to the next node in the list.
+
+public:
+    DoublyNode(std::string data); // Constructor
+    ~DoublyNode();                // Destructor
+
+    // Getter und Setter für 'index'
+    int get_index() const;
+    void set_index(const int &index);
+
+    // Getter und Setter für 'data'
+    std::string get_data() const;
+    void set_data(const std::string &new_data);
+
+    // Getter und Setter für 'prev_node_ptr'
+    DoublyNode *get_prev_node_ptr() const;
+    void set_prev_node_ptr(DoublyNode *new_prev_node_ptr);
+
+    // Getter und Setter für 'next_node_ptr'
+    DoublyNode *get_next_node_ptr() const;
+    void set_next_node_ptr(DoublyNode *new_next_node_ptr);
+};
+
+#endif
@@ -0,0 +1,124 @@
+#include "single/ShardedSinglyLinkedList.h"
+
+#include <atomic>
+#include <thread>
+
+ShardedSinglyLinkedList::ShardedSinglyLinkedList(std::size_t stripe_count)
+{
+    if (stripe_count == 0)
+        stripe_count = std::thread::hardware_concurrency();
+
+    if (stripe_count == 0)
+        stripe_count = 1; // hardware_concurrency() is 0 if it cannot be determined
+
+    this->stripe_count = stripe_count;
+    this->stripes.reset(new Stripe[stripe_count]);
+}
+
+ShardedSinglyLinkedList::~ShardedSinglyLinkedList()
+{
+    // The list does not own its nodes (like SinglyLinkedList), only unlink the nodes that were not drained
+    for (std::size_t i = 0; i < stripe_count; i++)
+    {
+        SinglyNode *current_node = stripes[i].head_node_ptr;
+
+        while (current_node != nullptr)
+        {
+            SinglyNode *next_node_ptr = current_node->get_next_node_ptr();
+            current_node->set_next_node_ptr(nullptr);
+            current_node->set_in_list(false);
+            current_node->set_index(INVALID_INDEX);
+            current_node = next_node_ptr;
+        }
+    }
+}
+
+ShardedSinglyLinkedList::Stripe &ShardedSinglyLinkedList::get_stripe_of_thread() const
+{
+    // Every thread gets a fixed slot once (round robin), so consecutive threads use different stripes
+    static std::atomic<std::size_t> next_thread_slot{0};
+    thread_local const std::size_t thread_slot = next_thread_slot.fetch_add(1, std::memory_order_relaxed);
+
+    return stripes[thread_slot % stripe_count];
+}
+
+void ShardedSinglyLinkedList::push_back(SinglyNode &new_node)
+{
+    // Checked in O(1) and without a lock: until it is pushed, the node belongs to the calling thread
+    if (new_node.is_in_list())
+        LINKEDLIST_THROW(std::runtime_error("Node already in a list"));
+
+    new_node.set_in_list(true);
+
+    new_node.set_index(INVALID_INDEX);
+    new_node.set_next_node_ptr(nullptr);
+
+    Stripe &stripe = get_stripe_of_thread();
+    std::lock_guard<std::mutex> lock(stripe.mutex);
+
+    if (stripe.tail_node_ptr == nullptr)
+        stripe.head_node_ptr = &new_node;
+    else
+        stripe.tail_node_ptr->set_next_node_ptr(&new_node);
+
+    stripe.tail_node_ptr = &new_node;
+    stripe.node_count++;
+}
+
+int ShardedSinglyLinkedList::size() const
+{
+    int node_count = 0;
+
+    for (std::size_t i = 0; i < stripe_count; i++)
+    {
+        std::lock_guard<std::mutex> lock(stripes[i].mutex);
+        node_count += stripes[i].node_count;
+    }
+
+    return node_count;
+}
+
+bool ShardedSinglyLinkedList::is_empty() const
+{
+    return size() == 0;
+}
+
+std::size_t ShardedSinglyLinkedList::get_stripe_count() const
+{
+    return stripe_count;
+}
+
+void ShardedSinglyLinkedList::for_each(const std::function<void(SinglyNode &)> &func) const
+{
+    for (std::size_t i = 0; i < stripe_count; i++)
+    {
+        std::lock_guard<std::mutex> lock(stripes[i].mutex);
+
+        for (SinglyNode *current_node = stripes[i].head_node_ptr; current_node != nullptr; current_node = current_node->get_next_node_ptr())
+            func(*current_node);
+    }
+}
+
+void ShardedSinglyLinkedList::drain_to(SinglyLinkedList &list)
+{
+    for (std::size_t i = 0; i < stripe_count; i++)
+    {
+        SinglyNode *first_node_ptr;
+        SinglyNode *last_node_ptr;
+
+        {
+            // Detach the whole chain in O(1); producers can continue on the empty stripe right away
+            std::lock_guard<std::mutex> lock(stripes[i].mutex);
+
+            first_node_ptr = stripes[i].head_node_ptr;
+            last_node_ptr = stripes[i].tail_node_ptr;
+
+            stripes[i].head_node_ptr = nullptr;
+            stripes[i].tail_node_ptr = nullptr;
+            stripes[i].node_count = 0;
+        }
+
+        if (first_node_ptr != nullptr)
+            list.append_chain(first_node_ptr, last_node_ptr);
+    }
+}
@@ -1,10 +1,81 @@
 #include "single/SinglyLinkedList.h"
 
+#include <algorithm>
+
+// Hint the CPU to load the given node into the cache (no-op on compilers without the builtin)
+#if defined(__GNUC__) || defined(__clang__)
+#define PREFETCH_NODE(node_ptr) __builtin_prefetch(node_ptr)
+#else
+#define PREFETCH_NODE(node_ptr) ((void)(node_ptr))
+#endif
+
+namespace
+{
+    // A requested index together with its position in the request (for returning the results in request order)
+    using IndexRequest = std::pair<int, std::size_t>;
+
+    // Returns the requests sorted by index, without the indexes that are out of range
+    std::vector<IndexRequest> sorted_requests(const std::vector<int> &indexes, int node_cnt)
+    {
+        std::vector<IndexRequest> requests;
+        requests.reserve(indexes.size());
+
+        for (std::size_t i = 0; i < indexes.size(); i++)
+        {
+            if (indexes[i] >= 0 && indexes[i] < node_cnt)
+                requests.emplace_back(indexes[i], i);
+        }
+
+        std::sort(requests.begin(), requests.end());
+        return requests;
+    }
+}
+
+SinglyLinkedList::Iterator::Iterator(SinglyNode *node_ptr)
+{
+    current_node_ptr = node_ptr;
+}
+
+SinglyNode &SinglyLinkedList::Iterator::operator*() const
+{
+    return *current_node_ptr;
+}
+
+SinglyNode *SinglyLinkedList::Iterator::operator->() const
+{
+    return current_node_ptr;
+}
+
+SinglyLinkedList::Iterator &SinglyLinkedList::Iterator::operator++()
+{
+    current_node_ptr = current_node_ptr->get_next_node_ptr();
+    return *this;
+}
+
+SinglyLinkedList::Iterator SinglyLinkedList::Iterator::operator++(int)
+{
+    Iterator previous = *this;
+    ++(*this);
+    return previous;
+}
+
+bool SinglyLinkedList::Iterator::operator==(const Iterator &other) const
+{
+    return current_node_ptr == other.current_node_ptr;
+}
+
+bool SinglyLinkedList::Iterator::operator!=(const Iterator &other) const
+{
+    return !(*this == other);
+}
+
 SinglyLinkedList::SinglyLinkedList()
 {
     // empty list at the beginning, set the head node_ptr to a nullptr
     head_node_ptr = nullptr;
     tail_node_ptr = nullptr;
+    finger_node_ptr.store(nullptr, std::memory_order_relaxed);
+    self_organizing_policy = SelfOrganizingPolicy::None;
 }
 
 SinglyLinkedList::~SinglyLinkedList()
@@ -15,17 +86,24 @@ SinglyLinkedList::~SinglyLinkedList()
 
 SinglyNode *SinglyLinkedList::get_node_at_index(const int &index) const
 {
-    SinglyNode *current_node = head_node_ptr;
+    // The tail node holds the highest index, so out of range indexes are rejected without a scan
+    if (is_empty() || index < 0 || index > tail_node_ptr->get_index())
+        return nullptr; // Node not found, return nullptr
 
-    while (current_node != nullptr)
-    {
-        if (current_node->get_index() == index)
-            return current_node; // Node found
+    if (index == tail_node_ptr->get_index())
+        return tail_node_ptr;
+
+    // Start at the finger if the wanted node is not before it, e.g. for sequential access get_node(i), get_node(i + 1), ...
+    SinglyNode *current_node = head_node_ptr;
+    SinglyNode *finger_ptr = finger_node_ptr.load(std::memory_order_relaxed);
+    if (finger_ptr != nullptr && finger_ptr->get_index() <= index)
+        current_node = finger_ptr;
 
+    while (current_node->get_index() != index)
         current_node = current_node->get_next_node_ptr();
-    }
 
-    return nullptr; // Node not found, return nullptr
+    finger_node_ptr.store(current_node, std::memory_order_relaxed); // Node found, remember it for the next lookup
+    return current_node;
 }
 
 bool SinglyLinkedList::node_in_list(const int &index) const
@@ -50,22 +128,65 @@ bool SinglyLinkedList::node_in_list(const SinglyNode &node) const
 
 void SinglyLinkedList::set_indexes()
 {
-    int i = 0;
-    SinglyNode *current_node = head_node_ptr;
+    set_indexes_from(head_node_ptr, 0);
+}
+
+void SinglyLinkedList::set_indexes_from(SinglyNode *node_ptr, int index)
+{
+    // Every mutation ends up here, the finger might point to a removed node or have an outdated index
+    finger_node_ptr.store(nullptr, std::memory_order_relaxed);
+
+    SinglyNode *current_node = node_ptr;
 
     while (current_node != nullptr)
     {
-        current_node->set_index(i);
+        current_node->set_index(index);
         current_node = current_node->get_next_node_ptr();
 
-        i++; // Post-increment operator
+        index++; // Post-increment operator
     }
 }
 
+void SinglyLinkedList::unlink(SinglyNode *node_ptr_before, SinglyNode *node_ptr)
+{
+    SinglyNode *node_ptr_after = node_ptr->get_next_node_ptr();
+
+    if (node_ptr_before == nullptr)
+        head_node_ptr = node_ptr_after; // The first node is removed
+    else
+        node_ptr_before->set_next_node_ptr(node_ptr_after);
+
+    if (node_ptr == tail_node_ptr)
+        tail_node_ptr = node_ptr_before; // The last node is removed (nullptr if the list is empty now)
+
+    node_ptr->set_next_node_ptr(nullptr); // The removed node no longer points into the list
+    node_ptr->set_in_list(false);
+    node_ptr->set_index(INVALID_INDEX);
+
+    set_indexes();
+}
+
+void SinglyLinkedList::append_chain(SinglyNode *first_node_ptr, SinglyNode *last_node_ptr)
+{
+    const int first_index = size();
+
+    if (is_empty())
+        head_node_ptr = first_node_ptr;
+    else
+        tail_node_ptr->set_next_node_ptr(first_node_ptr);
+
+    tail_node_ptr = last_node_ptr;
+    last_node_ptr->set_next_node_ptr(nullptr);
+
+    set_indexes_from(first_node_ptr, first_index); // Only the appended nodes get new indexes
+}
+
 void SinglyLinkedList::push_front(SinglyNode &new_node)
 {
-    if (node_in_list(new_node))
-        throw std::runtime_error("Node already in the list");
+    if (new_node.is_in_list())
+        LINKEDLIST_THROW(std::runtime_error("Node already in a list"));
+
+    new_node.set_in_list(true);
 
     // Check for an empty list
     if (is_empty())
@@ -102,8 +223,10 @@ void SinglyLinkedList::push_front(SinglyNode &new_node)
 
 void SinglyLinkedList::push_back(SinglyNode &new_node)
 {
-    if (node_in_list(new_node))
-        throw std::runtime_error("Node already in the list");
+    if (new_node.is_in_list())
+        LINKEDLIST_THROW(std::runtime_error("Node already in a list"));
+
+    new_node.set_in_list(true);
 
     if (is_empty())
     {
@@ -146,13 +269,13 @@ void SinglyLinkedList::insert(int index, SinglyNode &new_node)
     {
         // The insert method is used to populate an empty list
         if (index != 0)
-            throw std::out_of_range("Index: " + std::to_string(index) + " out of bounds");
+            LINKEDLIST_THROW(std::out_of_range("Index: " + std::to_string(index) + " out of bounds"));
     }
 
     // ==> The list has at least one node; check if the index is out of range
     else if ((index < head_node_ptr->get_index()) || (index > tail_node_ptr->get_index()))
     {
-        throw std::out_of_range("Index: " + std::to_string(index) + " out of bounds");
+        LINKEDLIST_THROW(std::out_of_range("Index: " + std::to_string(index) + " out of bounds"));
     }
 
     // ==> The passed index is valid; check if the index is equal to the first or last node and use the appropriate method for it
@@ -169,8 +292,10 @@ void SinglyLinkedList::insert(int index, SinglyNode &new_node)
 
     // ==> At this point, the node needs to be inserted somewhere in the middle of the list => no adjustments on the head_node_ptr or the tail_node_ptr are needed.
 
-    if (node_in_list(new_node))
-        throw std::runtime_error("Node already in the list");
+    if (new_node.is_in_list())
+        LINKEDLIST_THROW(std::runtime_error("Node already in a list"));
+
+    new_node.set_in_list(true);
 
     SinglyNode *node_ptr_before = get_node_at_index(index - 1);
     SinglyNode *node_ptr_after = get_node_at_index(index); // NOTE: current index is node after new node
@@ -183,7 +308,7 @@ void SinglyLinkedList::insert(int index, SinglyNode &new_node)
 SinglyNode &SinglyLinkedList::get_first() const
 {
     if (is_empty())
-        throw std::out_of_range("List is empty"); // If the list is empty, throw an exception
+        LINKEDLIST_THROW(std::out_of_range("List is empty")); // If the list is empty, throw an exception
 
     return *head_node_ptr; // Return a constant reference to the first node in the list
 }
@@ -191,23 +316,25 @@ SinglyNode &SinglyLinkedList::get_first() const
 SinglyNode &SinglyLinkedList::get_last() const
 {
     if (is_empty())
-        throw std::out_of_range("List is empty");
+        LINKEDLIST_THROW(std::out_of_range("List is empty"));
 
     return *tail_node_ptr; // Return a constant reference to the last node in the list
 }
 
 SinglyNode &SinglyLinkedList::get_node(const int &index) const
 {
-    if (!node_in_list(index))
-        throw std::out_of_range("Index out of range");
+    SinglyNode *node = try_get_node(index);
+
+    if (node == nullptr)
+        LINKEDLIST_THROW(std::out_of_range("Index out of range"));
 
-    return *get_node_at_index(index);
+    return *node;
 }
 
 SinglyNode &SinglyLinkedList::pop_front()
 {
     if (is_empty())
-        throw std::out_of_range("List is empty"); // If the list is empty, nothing to remove (pop)
+        LINKEDLIST_THROW(std::out_of_range("List is empty")); // If the list is empty, nothing to remove (pop)
 
     // Get a reference to the current first node in the linked list
     SinglyNode *removed_node = head_node_ptr;
@@ -215,6 +342,13 @@ SinglyNode &SinglyLinkedList::pop_front()
     // Update the head pointer to point to the NEW first (head) node of the list, after removing the previous first node
     head_node_ptr = head_node_ptr->get_next_node_ptr();
 
+    if (head_node_ptr == nullptr)
+        tail_node_ptr = nullptr; // The only node was removed
+
+    removed_node->set_next_node_ptr(nullptr); // The removed node no longer points into the list, so it can be added to another list
+    removed_node->set_in_list(false);
+    removed_node->set_index(INVALID_INDEX);
+
     // --> The previous first node is no longer part of the list because the head node ptr now points to the new first node.
     // Do not physicaly delete the removed node from memory (delete removed_node;); it's already 'removed' from the list.
 
@@ -227,7 +361,7 @@ SinglyNode &SinglyLinkedList::pop_front()
 SinglyNode &SinglyLinkedList::pop_back()
 {
     if (is_empty())
-        throw std::out_of_range("List is empty");
+        LINKEDLIST_THROW(std::out_of_range("List is empty"));
 
     // There is only one node in the list, so we can treat it like the first node
     if (head_node_ptr == tail_node_ptr) // same as: if (head_node_ptr->get_next_node_ptr() == nullptr)
@@ -257,6 +391,10 @@ SinglyNode &SinglyLinkedList::pop_back()
     second_last_node_ptr->set_next_node_ptr(nullptr); // ... setting the 'next_node_ptr' attribute of the second last node of the list to a nullptr
     tail_node_ptr = second_last_node_ptr;             // ... and by setting the 'tail_node_ptr' to point to the just found second last node of the list
 
+    removed_node->set_in_list(false);
+
+    removed_node->set_index(INVALID_INDEX);
+
     set_indexes();
 
     return *removed_node;
@@ -264,73 +402,232 @@ SinglyNode &SinglyLinkedList::pop_back()
 
 void SinglyLinkedList::remove(const SinglyNode &node)
 {
-    if (!node_in_list(node))
-        throw std::logic_error("Given node is not part of the list");
+    if (!try_remove(node))
+        LINKEDLIST_THROW(std::logic_error("Given node is not part of the list"));
+}
 
-    // Check if the given node is the first or last node in the list
-    if (&node == head_node_ptr)
-    {
-        pop_front(); // method also adjusts the head_node_ptr
-        return;
-    }
-    else if (&node == tail_node_ptr)
-    {
-        pop_back(); // method also adjusts the tail_node_ptr
-        return;
-    }
-    // => The given node is not the first or the last node in the list, therefore no adjustments on the head_node_ptr or the tail_node_ptr are needed.
+SinglyNode &SinglyLinkedList::remove(int index)
+{
+    SinglyNode *removed_node = try_remove(index);
+
+    if (removed_node == nullptr)
+        LINKEDLIST_THROW(std::out_of_range("Index out of bounds"));
+
+    return *removed_node;
+}
 
-    // Find the node to be removed
-    SinglyNode *node_ptr_before;
-    SinglyNode *node_ptr_after;
+int SinglyLinkedList::index_of(const SinglyNode &node) const
+{
+    int index = try_index_of(node);
+
+    if (index == INVALID_INDEX)
+        LINKEDLIST_THROW(std::logic_error("Given node is not part of the list"));
+
+    return index;
+}
+
+SinglyNode *SinglyLinkedList::try_get_node(const int &index) const
+{
+    return get_node_at_index(index); // nullptr if there is no node with the given index
+}
+
+SinglyNode *SinglyLinkedList::try_remove(int index)
+{
+    // Find the node and its predecessor in a single pass
+    SinglyNode *node_ptr_before = nullptr;
     SinglyNode *curr_node_ptr = head_node_ptr;
 
-    while (true)
+    while (curr_node_ptr != nullptr)
     {
-
-        if (curr_node_ptr->get_next_node_ptr() == &node) // next node in the loop iteration would be the actual node to be removed
+        if (curr_node_ptr->get_index() == index)
         {
-            // Node before the node to be removed is set to the current node
-            node_ptr_before = curr_node_ptr;
+            unlink(node_ptr_before, curr_node_ptr);
+            return curr_node_ptr;
+        }
 
-            // Node after the node to be removed is set to the node after the next node
-            node_ptr_after = curr_node_ptr->get_next_node_ptr()->get_next_node_ptr();
+        node_ptr_before = curr_node_ptr;
+        curr_node_ptr = curr_node_ptr->get_next_node_ptr();
+    }
 
-            break;
+    return nullptr; // Index not in the list, nothing removed
+}
+
+bool SinglyLinkedList::try_remove(const SinglyNode &node)
+{
+    SinglyNode *node_ptr_before = nullptr;
+    SinglyNode *curr_node_ptr = head_node_ptr;
+
+    while (curr_node_ptr != nullptr)
+    {
+        if (curr_node_ptr == &node)
+        {
+            unlink(node_ptr_before, curr_node_ptr);
+            return true;
         }
 
+        node_ptr_before = curr_node_ptr;
         curr_node_ptr = curr_node_ptr->get_next_node_ptr();
     }
 
-    // Remove the given node from the list by ...
-    node_ptr_before->set_next_node_ptr(node_ptr_after); //... setting the 'node_ptr_before' to point to the node after the removed node
-    // NOTE: Because the node is not at the end or beginning of the list at this point, the head and tail node pointers are not adjusted!
+    return false; // Given node is not part of the list
+}
 
-    set_indexes();
+int SinglyLinkedList::try_index_of(const SinglyNode &node) const
+{
+    if (!node_in_list(node))
+        return INVALID_INDEX;
+
+    return node.get_index();
 }
 
-SinglyNode &SinglyLinkedList::remove(int index)
+std::vector<SinglyNode *> SinglyLinkedList::multi_get(const std::vector<int> &indexes) const
 {
+    std::vector<SinglyNode *> results(indexes.size(), nullptr);
+    std::vector<IndexRequest> requests = sorted_requests(indexes, size());
 
-    if (!node_in_list(index))
-        throw std::out_of_range("Index out of bounds");
-    // throw std::logic_error("Given node is not part of the list");
+    SinglyNode *current_node = head_node_ptr;
+    int current_index = 0;
 
-    // Find the node to remove by its index
-    SinglyNode *node_to_remove = get_node_at_index(index);
+    for (const IndexRequest &request : requests)
+    {
+        // Continue the sweep where the previous request stopped
+        while (current_index < request.first)
+        {
+            current_node = current_node->get_next_node_ptr();
+            current_index++;
+        }
 
-    remove(*node_to_remove); // Remove the node from the list --> DEREFERENCE THE NODE
-    // set_indexes(); // not needed, because indexes are already set in the remove() method
+        results[request.second] = current_node;
+    }
 
-    return *node_to_remove; // dereference the node to return it to return the actual node object
+    return results;
 }
 
-int SinglyLinkedList::index_of(const SinglyNode &node) const
+std::vector<SinglyNode *> SinglyLinkedList::multi_remove(const std::vector<int> &indexes)
 {
-    if (!node_in_list(node))
-        throw std::logic_error("Given node is not part of the list");
+    std::vector<SinglyNode *> results(indexes.size(), nullptr);
+    std::vector<IndexRequest> requests = sorted_requests(indexes, size());
 
-    return node.get_index();
+    if (requests.empty())
+        return results;
+
+    SinglyNode *node_ptr_before = nullptr;
+    SinglyNode *current_node = head_node_ptr;
+    int current_index = 0; // Index of 'current_node' before any removal
+
+    SinglyNode *first_node_ptr_before = nullptr; // Predecessor of the first removed node (nullptr = head)
+
+    for (std::size_t i = 0; i < requests.size(); i++)
+    {
+        while (current_index < requests[i].first)
+        {
+            node_ptr_before = current_node;
+            current_node = current_node->get_next_node_ptr();
+            current_index++;
+        }
+
+        results[requests[i].second] = current_node;
+
+        // Duplicate requests share the node, unlink it with the last of them
+        if (i + 1 < requests.size() && requests[i + 1].first == current_index)
+            continue;
+
+        if (current_index == requests.front().first)
+            first_node_ptr_before = node_ptr_before;
+
+        SinglyNode *node_ptr_after = current_node->get_next_node_ptr();
+
+        if (node_ptr_before == nullptr)
+            head_node_ptr = node_ptr_after;
+        else
+            node_ptr_before->set_next_node_ptr(node_ptr_after);
+
+        if (current_node == tail_node_ptr)
+            tail_node_ptr = node_ptr_before;
+
+        current_node->set_next_node_ptr(nullptr);
+        current_node->set_in_list(false);
+        current_node->set_index(INVALID_INDEX);
+
+        // The predecessor stays the same for the next node
+        current_node = node_ptr_after;
+        current_index++;
+    }
+
+    // Renumber once, starting at the first removed position (also resets the finger, which might point to a removed node)
+    SinglyNode *first_node_ptr = first_node_ptr_before == nullptr ? head_node_ptr : first_node_ptr_before->get_next_node_ptr();
+    set_indexes_from(first_node_ptr, requests.front().first);
+
+    return results;
+}
+
+std::vector<SinglyNode *> SinglyLinkedList::multi_get_interleaved(const std::vector<std::pair<const SinglyLinkedList *, int>> &queries)
+{
+    // Sweep state of one list
+    struct Sweep
+    {
+        const SinglyLinkedList *list_ptr;
+        std::vector<IndexRequest> requests; // Sorted by index
+        std::size_t next_request;
+        SinglyNode *current_node;
+        int current_index;
+    };
+
+    std::vector<SinglyNode *> results(queries.size(), nullptr);
+    std::vector<Sweep> sweeps;
+
+    // Group the queries by list
+    for (std::size_t i = 0; i < queries.size(); i++)
+    {
+        const SinglyLinkedList *list_ptr = queries[i].first;
+        const int index = queries[i].second;
+
+        if (list_ptr == nullptr || index < 0 || index >= list_ptr->size())
+            continue;
+
+        auto sweep = std::find_if(sweeps.begin(), sweeps.end(), [&](const Sweep &other)
+                                  { return other.list_ptr == list_ptr; });
+
+        if (sweep == sweeps.end())
+            sweep = sweeps.insert(sweeps.end(), Sweep{list_ptr, {}, 0, list_ptr->head_node_ptr, 0});
+
+        sweep->requests.emplace_back(index, i);
+    }
+
+    for (Sweep &sweep : sweeps)
+        std::sort(sweep.requests.begin(), sweep.requests.end());
+
+    // Advance every unfinished sweep by one node per round, so the loads of different lists are in flight together
+    std::size_t active_cnt = sweeps.size();
+
+    while (active_cnt > 0)
+    {
+        for (Sweep &sweep : sweeps)
+        {
+            if (sweep.next_request == sweep.requests.size())
+                continue; // Finished
+
+            // Answer all requests for the current position
+            while (sweep.next_request < sweep.requests.size() && sweep.requests[sweep.next_request].first == sweep.current_index)
+            {
+                results[sweep.requests[sweep.next_request].second] = sweep.current_node;
+                sweep.next_request++;
+            }
+
+            if (sweep.next_request == sweep.requests.size())
+            {
+                active_cnt--;
+                continue;
+            }
+
+            sweep.current_node = sweep.current_node->get_next_node_ptr();
+            sweep.current_index++;
+
+            PREFETCH_NODE(sweep.current_node->get_next_node_ptr()); // Needed by this sweep in the next round
+        }
+    }
+
+    return results;
 }
 
 bool SinglyLinkedList::is_empty() const
@@ -348,16 +645,21 @@ int SinglyLinkedList::size() const
 
 void SinglyLinkedList::clear()
 {
-    // Iterate through the linked list, delete each node, and update the head pointer
+    // Iterate through the linked list, unlink each node, and update the head pointer
     while (head_node_ptr != nullptr)
     {
         SinglyNode *current_node = head_node_ptr;           // Create a temporary pointer to the current node
         head_node_ptr = head_node_ptr->get_next_node_ptr(); // Update the head pointer to the next node
 
-        // if (current_node != nullptr)
-        //     delete current_node; // Delete the current node to free memory (calls the destructor of the node class?!)
+        // The nodes are not owned by the list, so they are not deleted; they only no longer point into the list
+        current_node->set_next_node_ptr(nullptr);
+        current_node->set_in_list(false);
+        current_node->set_index(INVALID_INDEX);
     }
 
+    tail_node_ptr = nullptr;
+    finger_node_ptr.store(nullptr, std::memory_order_relaxed);
+
     /*
     NOTE:
     - Use "->" operator when working with a pointer to an object, accessing its methods and attributes using the -> operator (pointer).
@@ -365,9 +667,302 @@ void SinglyLinkedList::clear()
     */
 }
 
+void SinglyLinkedList::move_before(SinglyNode *node_ptr, SinglyNode *node_ptr_before, SinglyNode *target_ptr, SinglyNode *target_ptr_before)
+{
+    if (node_ptr == target_ptr)
+        return;
+
+    // Unlink the node ...
+    node_ptr_before->set_next_node_ptr(node_ptr->get_next_node_ptr());
+    if (node_ptr == tail_node_ptr)
+        tail_node_ptr = node_ptr_before;
+
+    // ... and link it in again before the target
+    node_ptr->set_next_node_ptr(target_ptr);
+    if (target_ptr_before == nullptr)
+        head_node_ptr = node_ptr;
+    else
+        target_ptr_before->set_next_node_ptr(node_ptr);
+
+    // Only the nodes between the old and the new position change their index (each one moves back by one)
+    node_ptr->set_index(target_ptr->get_index());
+
+    for (SinglyNode *current_node = target_ptr; current_node != node_ptr_before->get_next_node_ptr(); current_node = current_node->get_next_node_ptr())
+        current_node->set_index(current_node->get_index() + 1);
+
+    finger_node_ptr.store(nullptr, std::memory_order_relaxed);
+}
+
+SinglyNode *SinglyLinkedList::find(std::string_view data)
+{
+    // Keep the two predecessors of the current node for the reordering
+    SinglyNode *node_ptr_before_before = nullptr;
+    SinglyNode *node_ptr_before = nullptr;
+    SinglyNode *current_node = head_node_ptr;
+
+    while (current_node != nullptr && current_node->get_data_view() != data)
+    {
+        node_ptr_before_before = node_ptr_before;
+        node_ptr_before = current_node;
+        current_node = current_node->get_next_node_ptr();
+    }
+
+    if (current_node == nullptr)
+        return nullptr; // Not found, the order is unchanged
+
+    if (self_organizing_policy == SelfOrganizingPolicy::Count)
+        current_node->set_access_count(current_node->get_access_count() + 1);
+
+    if (node_ptr_before == nullptr)
+        return current_node; // Already the head node
+
+    switch (self_organizing_policy)
+    {
+    case SelfOrganizingPolicy::None:
+        break;
+
+    case SelfOrganizingPolicy::MoveToFront:
+        move_before(current_node, node_ptr_before, head_node_ptr, nullptr);
+        break;
+
+    case SelfOrganizingPolicy::Transpose:
+        move_before(current_node, node_ptr_before, node_ptr_before, node_ptr_before_before);
+        break;
+
+    case SelfOrganizingPolicy::Count:
+    {
+        const int access_count = current_node->get_access_count();
+
+        if (node_ptr_before->get_access_count() >= access_count)
+            break; // Still in order
+
+        // Move the node before the first node with a lower count (searching at most up to the node itself)
+        SinglyNode *target_ptr_before = nullptr;
+        SinglyNode *target_ptr = head_node_ptr;
+
+        while (target_ptr->get_access_count() >= access_count)
+        {
+            target_ptr_before = target_ptr;
+            target_ptr = target_ptr->get_next_node_ptr();
+        }
+
+        move_before(current_node, node_ptr_before, target_ptr, target_ptr_before);
+        break;
+    }
+    }
+
+    return current_node;
+}
+
+SelfOrganizingPolicy SinglyLinkedList::get_self_organizing_policy() const
+{
+    return self_organizing_policy;
+}
+
+void SinglyLinkedList::set_self_organizing_policy(SelfOrganizingPolicy policy)
+{
+    self_organizing_policy = policy;
+}
+
+void SinglyLinkedList::merge(SinglyLinkedList &other)
+{
+    if (&other == this || other.is_empty())
+        return;
+
+    SinglyNode *this_node_ptr = head_node_ptr;
+    SinglyNode *other_node_ptr = other.head_node_ptr;
+    SinglyNode *merged_tail_ptr = nullptr;
+    int index = 0;
+
+    // Take the smaller node of both lists until one of them is exhausted (on equal data this list goes first)
+    while (this_node_ptr != nullptr && other_node_ptr != nullptr)
+    {
+        SinglyNode *next_node_ptr;
+
+        if (other_node_ptr->compare_data(*this_node_ptr) < 0)
+        {
+            next_node_ptr = other_node_ptr;
+            other_node_ptr = other_node_ptr->get_next_node_ptr();
+        }
+        else
+        {
+            next_node_ptr = this_node_ptr;
+            this_node_ptr = this_node_ptr->get_next_node_ptr();
+        }
+
+        if (merged_tail_ptr == nullptr)
+            head_node_ptr = next_node_ptr;
+        else
+            merged_tail_ptr->set_next_node_ptr(next_node_ptr);
+
+        next_node_ptr->set_index(index++);
+        merged_tail_ptr = next_node_ptr;
+    }
+
+    // Append the rest of the list that is not exhausted yet
+    SinglyNode *rest_node_ptr = this_node_ptr != nullptr ? this_node_ptr : other_node_ptr;
+
+    if (rest_node_ptr == other_node_ptr)
+        tail_node_ptr = other.tail_node_ptr; // Otherwise the tail of this list stays the tail
+
+    if (merged_tail_ptr == nullptr)
+        head_node_ptr = rest_node_ptr;
+    else
+        merged_tail_ptr->set_next_node_ptr(rest_node_ptr);
+
+    set_indexes_from(rest_node_ptr, index);
+
+    // All nodes belong to this list now
+    other.head_node_ptr = nullptr;
+    other.tail_node_ptr = nullptr;
+    other.finger_node_ptr.store(nullptr, std::memory_order_relaxed);
+}
+
+int SinglyLinkedList::unique()
+{
+    finger_node_ptr.store(nullptr, std::memory_order_relaxed); // The finger could point to a removed node
+
+    if (is_empty())
+        return 0;
+
+    int removed_cnt = 0;
+    SinglyNode *current_node = head_node_ptr;
+    current_node->set_index(0);
+
+    while (current_node->get_next_node_ptr() != nullptr)
+    {
+        SinglyNode *next_node_ptr = current_node->get_next_node_ptr();
+
+        if (next_node_ptr->data_equals(*current_node))
+        {
+            // Duplicate: unlink it and compare the following node with the current node again
+            current_node->set_next_node_ptr(next_node_ptr->get_next_node_ptr());
+            next_node_ptr->set_next_node_ptr(nullptr);
+            next_node_ptr->set_in_list(false);
+            next_node_ptr->set_index(INVALID_INDEX);
+            removed_cnt++;
+        }
+        else
+        {
+            next_node_ptr->set_index(current_node->get_index() + 1);
+            current_node = next_node_ptr;
+        }
+    }
+
+    tail_node_ptr = current_node;
+
+    return removed_cnt;
+}
+
+void SinglyLinkedList::reverse()
+{
+    finger_node_ptr.store(nullptr, std::memory_order_relaxed);
+
+    const int last_index = size() - 1;
+
+    SinglyNode *prev_node_ptr = nullptr;
+    SinglyNode *current_node = head_node_ptr;
+
+    while (current_node != nullptr)
+    {
+        SinglyNode *next_node_ptr = current_node->get_next_node_ptr();
+
+        current_node->set_next_node_ptr(prev_node_ptr); // Let the node point backwards
+        current_node->set_index(last_index - current_node->get_index());
+
+        prev_node_ptr = current_node;
+        current_node = next_node_ptr;
+    }
+
+    // Swap head and tail
+    tail_node_ptr = head_node_ptr;
+    head_node_ptr = prev_node_ptr;
+}
+
+void SinglyLinkedList::rotate(int steps)
+{
+    const int node_cnt = size();
+
+    if (node_cnt == 0)
+        return;
+
+    steps = ((steps % node_cnt) + node_cnt) % node_cnt; // Normalize to [0, node_cnt)
+    if (steps == 0)
+        return;
+
+    // The node before the new head becomes the new tail
+    SinglyNode *new_tail_node_ptr = get_node_at_index(steps - 1);
+
+    tail_node_ptr->set_next_node_ptr(head_node_ptr); // Close the ring ...
+    head_node_ptr = new_tail_node_ptr->get_next_node_ptr();
+    new_tail_node_ptr->set_next_node_ptr(nullptr); // ... and open it again after the new tail
+    tail_node_ptr = new_tail_node_ptr;
+
+    set_indexes();
+}
+
+int SinglyLinkedList::partition(const std::function<bool(const SinglyNode &)> &pred)
+{
+    // Renumbers the nodes when leaving, also if 'pred' throws (the list is then consistent, but only partly partitioned)
+    struct IndexGuard
+    {
+        SinglyLinkedList *list_ptr;
+        ~IndexGuard() { list_ptr->set_indexes(); }
+    } index_guard{this};
+
+    // Matching nodes are moved behind the last matching node at the front; 'pred' only sees nodes that are still linked
+    SinglyNode *true_tail_ptr = nullptr;
+    SinglyNode *node_ptr_before = nullptr;
+    SinglyNode *current_node = head_node_ptr;
+    int true_cnt = 0;
+
+    while (current_node != nullptr)
+    {
+        SinglyNode *next_node_ptr = current_node->get_next_node_ptr();
+
+        if (!pred(*current_node))
+        {
+            node_ptr_before = current_node;
+        }
+        else if (node_ptr_before == true_tail_ptr)
+        {
+            // Already directly behind the matching nodes
+            true_tail_ptr = current_node;
+            node_ptr_before = current_node;
+            true_cnt++;
+        }
+        else
+        {
+            // Unlink the node (its predecessor stays the predecessor of the next node) ...
+            node_ptr_before->set_next_node_ptr(next_node_ptr);
+            if (current_node == tail_node_ptr)
+                tail_node_ptr = node_ptr_before;
+
+            // ... and link it in again behind the matching nodes
+            if (true_tail_ptr == nullptr)
+            {
+                current_node->set_next_node_ptr(head_node_ptr);
+                head_node_ptr = current_node;
+            }
+            else
+            {
+                current_node->set_next_node_ptr(true_tail_ptr->get_next_node_ptr());
+                true_tail_ptr->set_next_node_ptr(current_node);
+            }
+
+            true_tail_ptr = current_node;
+            true_cnt++;
+        }
+
+        current_node = next_node_ptr;
+    }
+
+    return true_cnt;
+}
+
 void SinglyLinkedList::sort_by()
 {
-    throw std::logic_error("Method not yet implemented");
+    LINKEDLIST_THROW(std::logic_error("Method not yet implemented"));
 }
 
 void SinglyLinkedList::display() const
@@ -392,3 +987,97 @@ void SinglyLinkedList::display() const
     std::cout << "Head Pointer:\t" << head_node_ptr << space << "|" << space << "Tail Pointer:\t" << tail_node_ptr << std::endl;
     std::cout << "= &First Node:\t" << &get_first() << space << "|" << space << "= &Last Node:\t" << &get_last() << std::endl;
 }
+
+SinglyLinkedList::Iterator SinglyLinkedList::begin() const
+{
+    return Iterator(head_node_ptr);
+}
+
+SinglyLinkedList::Iterator SinglyLinkedList::end() const
+{
+    return Iterator(nullptr); // One past the tail node
+}
+
+SinglyLinkedList::Cursor SinglyLinkedList::get_cursor(const int &index)
+{
+    SinglyNode *node = get_node_at_index(index);
+
+    if (node == nullptr)
+        LINKEDLIST_THROW(std::out_of_range("Index out of range"));
+
+    return Cursor(this, node);
+}
+
+SinglyLinkedList::Cursor::Cursor(SinglyLinkedList *list_ptr, SinglyNode *current_node_ptr)
+{
+    this->list_ptr = list_ptr;
+    this->current_node_ptr = current_node_ptr;
+}
+
+bool SinglyLinkedList::Cursor::is_valid() const
+{
+    return current_node_ptr != nullptr;
+}
+
+SinglyNode &SinglyLinkedList::Cursor::get() const
+{
+    if (!is_valid())
+        LINKEDLIST_THROW(std::out_of_range("Cursor is past the end of the list"));
+
+    return *current_node_ptr;
+}
+
+int SinglyLinkedList::Cursor::index() const
+{
+    return get().get_index();
+}
+
+bool SinglyLinkedList::Cursor::advance(int steps)
+{
+    while (steps > 0 && current_node_ptr != nullptr)
+    {
+        current_node_ptr = current_node_ptr->get_next_node_ptr();
+        steps--;
+    }
+
+    return is_valid();
+}
+
+void SinglyLinkedList::Cursor::insert_after(SinglyNode &new_node)
+{
+    SinglyNode &node = get();
+
+    if (new_node.is_in_list())
+        LINKEDLIST_THROW(std::runtime_error("Node already in a list")); // O(1), the cursor does not search the list
+
+    new_node.set_in_list(true);
+    new_node.set_next_node_ptr(node.get_next_node_ptr());
+    node.set_next_node_ptr(&new_node);
+
+    if (&node == list_ptr->tail_node_ptr)
+        list_ptr->tail_node_ptr = &new_node;
+
+    // Only the nodes from the new node onwards change their index
+    list_ptr->set_indexes_from(&new_node, node.get_index() + 1);
+}
+
+SinglyNode &SinglyLinkedList::Cursor::erase_after()
+{
+    SinglyNode &node = get();
+    SinglyNode *removed_node = node.get_next_node_ptr();
+
+    if (removed_node == nullptr)
+        LINKEDLIST_THROW(std::out_of_range("No node after the cursor"));
+
+    node.set_next_node_ptr(removed_node->get_next_node_ptr());
+    removed_node->set_next_node_ptr(nullptr);
+    removed_node->set_in_list(false);
+    removed_node->set_index(INVALID_INDEX);
+
+    if (removed_node == list_ptr->tail_node_ptr)
+        list_ptr->tail_node_ptr = &node;
+
+    list_ptr->set_indexes_from(node.get_next_node_ptr(), node.get_index() + 1);
+
+    return *removed_node;
+}
@@ -1,22 +1,87 @@
 #include "single/SinglyNode.h"
 
-SinglyNode::SinglyNode(std::string data)
+#include <new>
+#include <utility>
+
+SinglyNode::SinglyNode(std::string data) : owned_data(std::move(data))
 {
-    this->data = data;
+    this->interned = false;
     this->index = INVALID_INDEX;
+    this->access_count = 0;
     this->next_node_ptr = nullptr;
+    this->in_list = false;
+}
+
+SinglyNode::SinglyNode(StringPool &pool, std::string_view data) : interned_data_ptr(pool.intern(data))
+{
+    this->interned = true;
+    this->index = INVALID_INDEX;
+    this->access_count = 0;
+    this->next_node_ptr = nullptr;
+    this->in_list = false;
+}
+
+SinglyNode::SinglyNode(const SinglyNode &other) : interned_data_ptr(other.interned ? other.interned_data_ptr : nullptr)
+{
+    if (!other.interned)
+        new (&owned_data) std::string(other.owned_data);
+
+    this->interned = other.interned;
+    this->index = INVALID_INDEX;
+    this->access_count = other.access_count;
+    this->next_node_ptr = nullptr;
+    this->in_list = false;
+}
+
+SinglyNode &SinglyNode::operator=(const SinglyNode &other)
+{
+    if (this != &other)
+    {
+        // Only the data is assigned, the node keeps its position in a list
+        if (other.interned)
+        {
+            release_data();
+            this->interned_data_ptr = other.interned_data_ptr;
+            this->interned = true;
+        }
+        else
+        {
+            assign_owned_data(other.owned_data);
+        }
+
+        this->access_count = other.access_count;
+    }
+
+    return *this;
 }
 
 SinglyNode::~SinglyNode()
 {
-    // std::cout << "Destructor of '" << data << "' called" << std::endl;
+    // std::cout << "Destructor of '" << get_data() << "' called" << std::endl;
+    release_data();
 }
 
-int SinglyNode::get_index() const
+void SinglyNode::release_data()
 {
-    if (this == nullptr)
-        throw std::invalid_argument("Node hasn't been initialized yet and therefore no valid index");
+    if (!this->interned)
+        this->owned_data.~basic_string();
+}
+
+void SinglyNode::assign_owned_data(const std::string &new_data)
+{
+    if (!this->interned)
+    {
+        this->owned_data = new_data; // Reuses the buffer of the current data
+        return;
+    }
+
+    std::string copy(new_data); // Copy first: if it throws, the node still holds its interned data
+    new (&this->owned_data) std::string(std::move(copy));
+    this->interned = false;
+}
 
+int SinglyNode::get_index() const
+{
     return this->index;
 }
 
@@ -25,14 +90,62 @@ void SinglyNode::set_index(const int &index)
     this->index = index;
 }
 
+int SinglyNode::get_access_count() const
+{
+    return this->access_count;
+}
+
+void SinglyNode::set_access_count(const int &access_count)
+{
+    this->access_count = access_count;
+}
+
 std::string SinglyNode::get_data() const
 {
-    return std::string(this->data);
+    return std::string(get_data_view());
 }
 
 void SinglyNode::set_data(const std::string &new_data)
 {
-    this->data = new_data;
+    assign_owned_data(new_data);
+}
+
+void SinglyNode::set_data(StringPool &pool, std::string_view new_data)
+{
+    const StringPool::Entry *entry = pool.intern(new_data); // Intern first, 'new_data' might view the current data
+    release_data();
+    this->interned_data_ptr = entry;
+    this->interned = true;
+}
+
+std::string_view SinglyNode::get_data_view() const
+{
+    if (this->interned)
+        return this->interned_data_ptr->data;
+
+    return this->owned_data;
+}
+
+bool SinglyNode::is_interned() const
+{
+    return this->interned;
+}
+
+int SinglyNode::compare_data(const SinglyNode &other) const
+{
+    if (this->interned && other.interned && this->interned_data_ptr == other.interned_data_ptr)
+        return 0; // Same interned string
+
+    return get_data_view().compare(other.get_data_view());
+}
+
+bool SinglyNode::data_equals(const SinglyNode &other) const
+{
+    // Strings of the same pool are deduplicated, so equal data means the same entry
+    if (this->interned && other.interned && this->interned_data_ptr->pool_ptr == other.interned_data_ptr->pool_ptr)
+        return this->interned_data_ptr == other.interned_data_ptr;
+
+    return get_data_view() == other.get_data_view();
 }
 
 SinglyNode *SinglyNode::get_next_node_ptr() const
@@ -45,6 +158,16 @@ void SinglyNode::set_next_node_ptr(SinglyNode *new_next_node_ptr)
     this->next_node_ptr = new_next_node_ptr;
 }
 
+bool SinglyNode::is_in_list() const
+{
+    return this->in_list;
+}
+
+void SinglyNode::set_in_list(const bool &in_list)
+{
+    this->in_list = in_list;
+}
+
 void SinglyNode::print() const
 {
 
@@ -71,7 +194,7 @@ void SinglyNode::print() const
     this_ptr_line += std::string(this_ptr_padding, ' ') + "|";
 
     // DATA LINE
-    std::string data_line = "| data = '" + this->data + "'";
+    std::string data_line = "| data = '" + get_data() + "'";
     int data_padding = node_width - data_line.length() - 1; // -1 for | character
     data_line += std::string(data_padding, ' ') + "|";
 
@@ -0,0 +1,29 @@
+#include "single/StringPool.h"
+
+StringPool::StringPool()
+{
+}
+
+StringPool::~StringPool()
+{
+}
+
+const StringPool::Entry *StringPool::intern(std::string_view data)
+{
+    // Lookup by view, so a hit neither allocates nor copies the string
+    auto found = lookup.find(data);
+    if (found != lookup.end())
+        return found->second;
+
+    entries.push_back(Entry{std::string(data), this});
+    const Entry *entry = &entries.back();
+
+    lookup.emplace(std::string_view(entry->data), entry); // The key refers to the stored copy, not to the argument
+
+    return entry;
+}
+
+std::size_t StringPool::size() const
+{
+    return entries.size();
+}
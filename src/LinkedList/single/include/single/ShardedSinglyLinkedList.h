@@ -0,0 +1,69 @@
+#ifndef SHARDEDSINGLYLINKEDLIST_H
+#define SHARDEDSINGLYLINKEDLIST_H
+
+/*
+Singly linked list for high-rate concurrent appends.
+
+- The nodes are spread over several stripes, each a chain of SinglyNodes with its own head, tail and mutex.
+  Every thread appends to "its" stripe, so threads rarely contend on the same tail.
+- push_back() is thread-safe and O(1): no index update (the indexes of the nodes are only set when they
+  are drained into a SinglyLinkedList). A node that is already in a list (this or any other one) is rejected
+  in O(1) with its 'in_list' flag; it stays set while the node is in a stripe and after it is drained.
+- Consumers see one logical list: size(), for_each() and drain_to() combine the stripes lazily, in stripe order.
+  The order of nodes appended by one thread is kept; nodes of different threads may interleave in any order.
+*/
+
+#include <cstddef>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include "SinglyLinkedList.h"
+#include "SinglyNode.h"
+
+class ShardedSinglyLinkedList
+{
+private:
+    // One sub-list; aligned to its own cache line so stripes of different threads do not share one
+    struct alignas(64) Stripe
+    {
+        std::mutex mutex;
+        SinglyNode *head_node_ptr = nullptr;
+        SinglyNode *tail_node_ptr = nullptr;
+        int node_count = 0;
+    };
+
+    std::unique_ptr<Stripe[]> stripes;
+
+    std::size_t stripe_count;
+
+    // Returns the stripe the calling thread appends to
+    Stripe &get_stripe_of_thread() const;
+
+public:
+    // Constructor; stripe_count = 0 uses one stripe per hardware thread
+    explicit ShardedSinglyLinkedList(std::size_t stripe_count = 0);
+    ~ShardedSinglyLinkedList(); // Destructor
+
+    ShardedSinglyLinkedList(const ShardedSinglyLinkedList &) = delete;
+    ShardedSinglyLinkedList &operator=(const ShardedSinglyLinkedList &) = delete;
+
+    // Adds a new node to the tail of the calling thread's stripe (thread-safe); throws if the node is already in a list
+    void push_back(SinglyNode &new_node);
+
+    // Returns the number of nodes in all stripes
+    int size() const;
+
+    // Returns true if all stripes are empty
+    bool is_empty() const;
+
+    // Returns the number of stripes
+    std::size_t get_stripe_count() const;
+
+    // Calls 'func' for every node, stripe by stripe (each stripe is locked while it is visited)
+    void for_each(const std::function<void(SinglyNode &)> &func) const;
+
+    // Moves all nodes to the tail of the given list (in stripe order); the stripes are empty afterwards
+    void drain_to(SinglyLinkedList &list);
+};
+
+#endif
@@ -6,9 +6,26 @@
 - double linked list: forwards and backwards
 */
 
+#include <atomic>
 #include <iostream>
+#include <iterator>
+#include <cstddef>
+#include <functional>
+#include <string_view>
+#include <utility>
+#include <vector>
+#include "common/LinkedListErrors.h"
 #include "SinglyNode.h"
 
+// How find() reorders the list after a successful lookup, so that frequently found nodes move towards the head
+enum class SelfOrganizingPolicy
+{
+    None,        // Keep the order (default)
+    MoveToFront, // Move the found node to the head
+    Transpose,   // Swap the found node with its predecessor
+    Count        // Count the finds of each node and keep the list sorted by that count (descending)
+};
+
 class SinglyLinkedList
 {
 private:
@@ -18,7 +35,16 @@ private:
     // Pointer to the last (tail) node in the list
     SinglyNode *tail_node_ptr;
 
-    // Returns a pointer to the node at the given index
+    // Reordering applied by find()
+    SelfOrganizingPolicy self_organizing_policy;
+
+    // Finger: the node found by the last positional lookup (nullptr = no finger).
+    // Lookups at or after its index start here instead of at the head; reset on every mutation.
+    // Const lookups update it, so it is atomic: concurrent const lookups stay free of data races
+    // (relaxed ordering is enough, any finger they see points to a node of the unchanged list)
+    mutable std::atomic<SinglyNode *> finger_node_ptr;
+
+    // Returns a pointer to the node at the given index (starting at the finger when possible)
     SinglyNode *get_node_at_index(const int &index) const;
 
     // Checks if a node is present in the list by its index
@@ -30,7 +56,85 @@ private:
     // Update the indexes of nodes in the list
     void set_indexes();
 
+    // Update the indexes starting at the given node, which gets 'index' (the nodes before are unchanged)
+    void set_indexes_from(SinglyNode *node_ptr, int index);
+
+    // Removes the given node from the list, 'node_ptr_before' is its predecessor (nullptr for the first node).
+    // Like every removal it resets the node: no next node, not in a list, INVALID_INDEX
+    void unlink(SinglyNode *node_ptr_before, SinglyNode *node_ptr);
+
+    // Appends an already linked chain of nodes (from 'first_node_ptr' to 'last_node_ptr') to the tail
+    void append_chain(SinglyNode *first_node_ptr, SinglyNode *last_node_ptr);
+
+    // Moves 'node_ptr' directly before 'target_ptr', which is located before it; the '..._before' pointers are their predecessors
+    void move_before(SinglyNode *node_ptr, SinglyNode *node_ptr_before, SinglyNode *target_ptr, SinglyNode *target_ptr_before);
+
+    friend class ShardedSinglyLinkedList; // Drains its stripes with append_chain()
+
 public:
+    // Forward iterator over the nodes of the list (yields 'SinglyNode &')
+    class Iterator
+    {
+    private:
+        SinglyNode *current_node_ptr;
+
+    public:
+        using iterator_category = std::forward_iterator_tag;
+        using value_type = SinglyNode;
+        using difference_type = std::ptrdiff_t;
+        using pointer = SinglyNode *;
+        using reference = SinglyNode &;
+
+        explicit Iterator(SinglyNode *node_ptr = nullptr);
+
+        SinglyNode &operator*() const;
+        SinglyNode *operator->() const;
+
+        Iterator &operator++();   // Prefix increment
+        Iterator operator++(int); // Postfix increment
+
+        bool operator==(const Iterator &other) const;
+        bool operator!=(const Iterator &other) const;
+    };
+
+    /*
+    Cursor pointing to a node of the list.
+    It moves forward in O(1) per step and can insert or erase the node after its position without
+    searching the list; only the indexes of the following nodes are updated.
+    A cursor is invalidated if its node is removed from the list by other means.
+    */
+    class Cursor
+    {
+    private:
+        SinglyLinkedList *list_ptr;
+        SinglyNode *current_node_ptr; // nullptr = moved past the end of the list
+
+    public:
+        Cursor(SinglyLinkedList *list_ptr, SinglyNode *current_node_ptr);
+
+        // Returns true if the cursor points to a node of the list
+        bool is_valid() const;
+
+        // Returns the node at the cursor position
+        SinglyNode &get() const;
+
+        // Returns the index of the node at the cursor position
+        int index() const;
+
+        // Moves the cursor 'steps' nodes forward, returns false if it moved past the end of the list
+        bool advance(int steps = 1);
+
+        // Inserts a new node directly after the cursor position (the cursor stays on its node).
+        // Throws if the node is already in a list, which is checked in O(1)
+        void insert_after(SinglyNode &new_node);
+
+        // Removes the node directly after the cursor position and returns it
+        SinglyNode &erase_after();
+    };
+
+    using iterator = Iterator;
+    using const_iterator = Iterator; // The list does not own its nodes, so both iterate over 'SinglyNode &'
+
     SinglyLinkedList();  // Constructor
     ~SinglyLinkedList(); // Destructor
 
@@ -49,7 +153,8 @@ public:
     // Returns the last (tail) node of the list
     SinglyNode &get_last() const;
 
-    // Returns the node at the given index
+    // Returns the node at the given index.
+    // Like all const methods it can be called from several threads at once, as long as no thread modifies the list
     SinglyNode &get_node(const int &index) const;
 
     // Removes and returns the head node of the list
@@ -67,6 +172,41 @@ public:
     // Returns the index of the given node
     int index_of(const SinglyNode &node) const;
 
+    /*
+    Non-throwing variants for lookups that are expected to miss (e.g. in hot loops).
+    They report a miss with a nullptr, false or INVALID_INDEX instead of throwing an exception,
+    and are the only lookups usable when the library is built with LINKEDLIST_NO_EXCEPTIONS.
+    */
+
+    // Returns a pointer to the node at the given index, or nullptr if the index is out of range
+    SinglyNode *try_get_node(const int &index) const;
+
+    // Removes the node at the specified index and returns it, or nullptr if the index is out of range
+    SinglyNode *try_remove(int index);
+
+    // Removes the given node from the list, returns false if the node is not part of the list
+    bool try_remove(const SinglyNode &node);
+
+    // Returns the index of the given node, or INVALID_INDEX if the node is not part of the list
+    int try_index_of(const SinglyNode &node) const;
+
+    /*
+    Batched lookups: the requested indexes are sorted and resolved in a single forward sweep,
+    so k lookups cost O(n + k log k) instead of O(k * n). Results are in the order of the request,
+    with a nullptr for every index that is out of range.
+    */
+
+    // Returns the nodes at the given indexes
+    std::vector<SinglyNode *> multi_get(const std::vector<int> &indexes) const;
+
+    // Removes the nodes at the given indexes (positions before the removal) and returns them.
+    // A node requested several times is removed once and returned for each request
+    std::vector<SinglyNode *> multi_remove(const std::vector<int> &indexes);
+
+    // Resolves (list, index) queries over several lists at once. The lists are swept in lockstep,
+    // one hop per list in turn, and the next node of each list is prefetched so their memory accesses overlap
+    static std::vector<SinglyNode *> multi_get_interleaved(const std::vector<std::pair<const SinglyLinkedList *, int>> &queries);
+
     // Returns true if the list is empty
     bool is_empty() const;
 
@@ -76,11 +216,47 @@ public:
     // Clears all nodes from the list
     void clear();
 
+    // Returns the first node with the given data, or nullptr if there is none.
+    // A successful find reorders the list according to the self-organizing policy
+    SinglyNode *find(std::string_view data);
+
+    // Getter und Setter für 'self_organizing_policy'
+    SelfOrganizingPolicy get_self_organizing_policy() const;
+    void set_self_organizing_policy(SelfOrganizingPolicy policy);
+
+    /*
+    Algorithms that relink the existing nodes in a single pass with O(1) extra memory.
+    No node is copied; nodes removed by unique() are only unlinked (the list does not own them).
+    */
+
+    // Merges the nodes of 'other' into this list; both lists must be sorted ascending by data. 'other' is empty afterwards
+    void merge(SinglyLinkedList &other);
+
+    // Removes consecutive nodes with equal data (keeps the first one), returns the number of removed nodes
+    int unique();
+
+    // Reverses the order of the nodes
+    void reverse();
+
+    // Rotates the list to the left by 'steps' (the node at index 'steps' becomes the head), negative steps rotate right
+    void rotate(int steps);
+
+    // Moves the nodes for which 'pred' is true before all other nodes, keeping the relative order in both groups.
+    // Returns the number of nodes for which 'pred' is true. If 'pred' throws, all nodes stay in the list (only partly partitioned)
+    int partition(const std::function<bool(const SinglyNode &)> &pred);
+
     // Sorts the linked list based on specific criteria
     void sort_by(); // A description of the sorting logic is missing here
 
     // Displays the contents of the linked list
     void display() const;
+
+    // Returns a cursor pointing to the node at the given index
+    Cursor get_cursor(const int &index);
+
+    // Iterators for range-for loops and the views in "SinglyLinkedListViews.h"
+    Iterator begin() const;
+    Iterator end() const;
 };
 
 #endif
@@ -0,0 +1,471 @@
+#ifndef SINGLYLINKEDLISTVIEWS_H
+#define SINGLYLINKEDLISTVIEWS_H
+
+/*
+Lazy, non-owning views over a SinglyLinkedList (or over another view).
+
+- No view copies a node or its data; every element is produced on demand while iterating.
+- Views can be nested or chained with '|', and all stages are fused into a single traversal:
+
+    for (SinglyNode &node : s_list | views::filter(is_valid) | views::take(3))
+        ...
+
+- An lvalue list is referenced by the view, so the list must outlive the view.
+  Views passed as rvalues (e.g. an inner stage of a chain) are stored by value.
+- Modifying the list while a view is being iterated invalidates the view (like the list iterators).
+*/
+
+#include <cstddef>
+#include <iterator>
+#include <type_traits>
+#include <utility>
+#include "common/LinkedListErrors.h"
+#include "SinglyLinkedList.h"
+
+namespace views
+{
+    // Iterator type of any range (list or view)
+    template <typename Range>
+    using iterator_t = decltype(std::declval<Range &>().begin());
+
+    // Type returned when dereferencing an iterator of the range
+    template <typename Range>
+    using reference_t = decltype(*std::declval<iterator_t<Range> &>());
+
+    // ===== filter =====
+
+    // Yields only the elements for which 'pred(element)' is true
+    template <typename Range, typename Pred>
+    class FilterView
+    {
+    private:
+        Range range; // Reference for an lvalue list, value for an inner view
+        Pred pred;
+
+    public:
+        class Iterator
+        {
+        private:
+            iterator_t<Range> current;
+            iterator_t<Range> last;
+            const Pred *pred_ptr;
+
+            // Skips forward to the next matching element (or to the end)
+            void satisfy()
+            {
+                while (current != last && !(*pred_ptr)(*current))
+                    ++current;
+            }
+
+        public:
+            using iterator_category = std::forward_iterator_tag;
+            using reference = reference_t<Range>;
+            using value_type = std::remove_cv_t<std::remove_reference_t<reference>>;
+            using difference_type = std::ptrdiff_t;
+            using pointer = std::add_pointer_t<reference>;
+
+            Iterator(iterator_t<Range> current, iterator_t<Range> last, const Pred *pred_ptr)
+                : current(current), last(last), pred_ptr(pred_ptr)
+            {
+                satisfy();
+            }
+
+            reference operator*() const { return *current; }
+
+            Iterator &operator++()
+            {
+                ++current;
+                satisfy();
+                return *this;
+            }
+
+            Iterator operator++(int)
+            {
+                Iterator previous = *this;
+                ++(*this);
+                return previous;
+            }
+
+            bool operator==(const Iterator &other) const { return current == other.current; }
+            bool operator!=(const Iterator &other) const { return !(*this == other); }
+        };
+
+        FilterView(Range &&range, Pred pred) : range(std::forward<Range>(range)), pred(std::move(pred)) {}
+
+        Iterator begin() { return Iterator(range.begin(), range.end(), &pred); }
+        Iterator end() { return Iterator(range.end(), range.end(), &pred); }
+    };
+
+    // ===== transform =====
+
+    // Yields 'func(element)' for every element; the result is computed on dereference
+    template <typename Range, typename Func>
+    class TransformView
+    {
+    private:
+        Range range;
+        Func func;
+
+    public:
+        class Iterator
+        {
+        private:
+            iterator_t<Range> current;
+            const Func *func_ptr;
+
+        public:
+            using iterator_category = std::input_iterator_tag; // Elements are computed values, not references
+            using reference = decltype(std::declval<const Func &>()(std::declval<reference_t<Range>>()));
+            using value_type = std::remove_cv_t<std::remove_reference_t<reference>>;
+            using difference_type = std::ptrdiff_t;
+            using pointer = void;
+
+            Iterator(iterator_t<Range> current, const Func *func_ptr) : current(current), func_ptr(func_ptr) {}
+
+            reference operator*() const { return (*func_ptr)(*current); }
+
+            Iterator &operator++()
+            {
+                ++current;
+                return *this;
+            }
+
+            Iterator operator++(int)
+            {
+                Iterator previous = *this;
+                ++(*this);
+                return previous;
+            }
+
+            bool operator==(const Iterator &other) const { return current == other.current; }
+            bool operator!=(const Iterator &other) const { return !(*this == other); }
+        };
+
+        TransformView(Range &&range, Func func) : range(std::forward<Range>(range)), func(std::move(func)) {}
+
+        Iterator begin() { return Iterator(range.begin(), &func); }
+        Iterator end() { return Iterator(range.end(), &func); }
+    };
+
+    // ===== take =====
+
+    // Iterator that stops after 'remaining' elements or at the end of the underlying range (shared by take and chunk)
+    template <typename It>
+    class CountedIterator
+    {
+    private:
+        It current;
+        It last;
+        std::size_t remaining;
+
+        bool at_end() const { return remaining == 0 || current == last; }
+
+    public:
+        using iterator_category = std::forward_iterator_tag;
+        using reference = decltype(*std::declval<It &>());
+        using value_type = std::remove_cv_t<std::remove_reference_t<reference>>;
+        using difference_type = std::ptrdiff_t;
+        using pointer = std::add_pointer_t<reference>;
+
+        CountedIterator(It current, It last, std::size_t remaining) : current(current), last(last), remaining(remaining) {}
+
+        reference operator*() const { return *current; }
+
+        CountedIterator &operator++()
+        {
+            ++current;
+            --remaining;
+            return *this;
+        }
+
+        CountedIterator operator++(int)
+        {
+            CountedIterator previous = *this;
+            ++(*this);
+            return previous;
+        }
+
+        // All exhausted iterators compare equal, so 'end()' does not need to know where the range stops
+        bool operator==(const CountedIterator &other) const
+        {
+            if (at_end() || other.at_end())
+                return at_end() == other.at_end();
+
+            return current == other.current;
+        }
+        bool operator!=(const CountedIterator &other) const { return !(*this == other); }
+    };
+
+    // Yields at most the first 'count' elements
+    template <typename Range>
+    class TakeView
+    {
+    private:
+        Range range;
+        std::size_t count;
+
+    public:
+        using Iterator = CountedIterator<iterator_t<Range>>;
+
+        TakeView(Range &&range, std::size_t count) : range(std::forward<Range>(range)), count(count) {}
+
+        Iterator begin() { return Iterator(range.begin(), range.end(), count); }
+        Iterator end() { return Iterator(range.end(), range.end(), 0); }
+    };
+
+    // ===== drop =====
+
+    // Skips the first 'count' elements; the skipping is done lazily when 'begin()' is called
+    template <typename Range>
+    class DropView
+    {
+    private:
+        Range range;
+        std::size_t count;
+
+    public:
+        using Iterator = iterator_t<Range>;
+
+        DropView(Range &&range, std::size_t count) : range(std::forward<Range>(range)), count(count) {}
+
+        Iterator begin()
+        {
+            Iterator current = range.begin();
+            Iterator last = range.end();
+
+            for (std::size_t i = 0; i < count && current != last; i++)
+                ++current;
+
+            return current;
+        }
+
+        Iterator end() { return range.end(); }
+    };
+
+    // ===== chunk =====
+
+    // Non-owning range of up to 'size' consecutive elements, yielded by ChunkView
+    template <typename It>
+    class Chunk
+    {
+    private:
+        It first;
+        It last;
+        std::size_t size;
+
+    public:
+        using Iterator = CountedIterator<It>;
+
+        Chunk(It first, It last, std::size_t size) : first(first), last(last), size(size) {}
+
+        Iterator begin() const { return Iterator(first, last, size); }
+        Iterator end() const { return Iterator(last, last, 0); }
+    };
+
+    // Splits the range into consecutive chunks of 'size' elements (the last chunk may be smaller)
+    template <typename Range>
+    class ChunkView
+    {
+    private:
+        Range range;
+        std::size_t size;
+
+    public:
+        class Iterator
+        {
+        private:
+            iterator_t<Range> current;
+            iterator_t<Range> last;
+            std::size_t size;
+
+        public:
+            using iterator_category = std::input_iterator_tag; // Chunks are yielded by value
+            using value_type = Chunk<iterator_t<Range>>;
+            using reference = value_type;
+            using difference_type = std::ptrdiff_t;
+            using pointer = void;
+
+            Iterator(iterator_t<Range> current, iterator_t<Range> last, std::size_t size)
+                : current(current), last(last), size(size) {}
+
+            value_type operator*() const { return value_type(current, last, size); }
+
+            Iterator &operator++()
+            {
+                for (std::size_t i = 0; i < size && current != last; i++)
+                    ++current;
+
+                return *this;
+            }
+
+            Iterator operator++(int)
+            {
+                Iterator previous = *this;
+                ++(*this);
+                return previous;
+            }
+
+            bool operator==(const Iterator &other) const { return current == other.current; }
+            bool operator!=(const Iterator &other) const { return !(*this == other); }
+        };
+
+        ChunkView(Range &&range, std::size_t size) : range(std::forward<Range>(range)), size(size)
+        {
+            if (size == 0)
+                LINKEDLIST_THROW(std::invalid_argument("Chunk size must be greater than 0"));
+        }
+
+        Iterator begin() { return Iterator(range.begin(), range.end(), size); }
+        Iterator end() { return Iterator(range.end(), range.end(), size); }
+    };
+
+    // ===== zip =====
+
+    // Yields pairs of elements from two ranges; stops at the end of the shorter range
+    template <typename Range1, typename Range2>
+    class ZipView
+    {
+    private:
+        Range1 range1;
+        Range2 range2;
+
+    public:
+        class Iterator
+        {
+        private:
+            iterator_t<Range1> current1;
+            iterator_t<Range2> current2;
+
+        public:
+            using iterator_category = std::input_iterator_tag; // Pairs are yielded by value
+            using value_type = std::pair<reference_t<Range1>, reference_t<Range2>>;
+            using reference = value_type;
+            using difference_type = std::ptrdiff_t;
+            using pointer = void;
+
+            Iterator(iterator_t<Range1> current1, iterator_t<Range2> current2) : current1(current1), current2(current2) {}
+
+            value_type operator*() const { return value_type(*current1, *current2); }
+
+            Iterator &operator++()
+            {
+                ++current1;
+                ++current2;
+                return *this;
+            }
+
+            Iterator operator++(int)
+            {
+                Iterator previous = *this;
+                ++(*this);
+                return previous;
+            }
+
+            // Equal as soon as either side matches, so iteration ends with the shorter range
+            bool operator==(const Iterator &other) const { return current1 == other.current1 || current2 == other.current2; }
+            bool operator!=(const Iterator &other) const { return !(*this == other); }
+        };
+
+        ZipView(Range1 &&range1, Range2 &&range2) : range1(std::forward<Range1>(range1)), range2(std::forward<Range2>(range2)) {}
+
+        Iterator begin() { return Iterator(range1.begin(), range2.begin()); }
+        Iterator end() { return Iterator(range1.end(), range2.end()); }
+    };
+
+    // ===== factory functions =====
+
+    /*
+    'Range' is deduced as 'T &' for lvalues (the view references the list) and as 'T' for rvalues (the view is moved in).
+    */
+
+    template <typename Range, typename Pred>
+    FilterView<Range, Pred> filter(Range &&range, Pred pred)
+    {
+        return FilterView<Range, Pred>(std::forward<Range>(range), std::move(pred));
+    }
+
+    template <typename Range, typename Func>
+    TransformView<Range, Func> transform(Range &&range, Func func)
+    {
+        return TransformView<Range, Func>(std::forward<Range>(range), std::move(func));
+    }
+
+    template <typename Range>
+    TakeView<Range> take(Range &&range, std::size_t count)
+    {
+        return TakeView<Range>(std::forward<Range>(range), count);
+    }
+
+    template <typename Range>
+    DropView<Range> drop(Range &&range, std::size_t count)
+    {
+        return DropView<Range>(std::forward<Range>(range), count);
+    }
+
+    template <typename Range>
+    ChunkView<Range> chunk(Range &&range, std::size_t size)
+    {
+        return ChunkView<Range>(std::forward<Range>(range), size);
+    }
+
+    template <typename Range1, typename Range2>
+    ZipView<Range1, Range2> zip(Range1 &&range1, Range2 &&range2)
+    {
+        return ZipView<Range1, Range2>(std::forward<Range1>(range1), std::forward<Range2>(range2));
+    }
+
+    // ===== pipe syntax =====
+
+    // Stores the arguments of a view until the range is supplied via 'range | adaptor'
+    template <typename Func>
+    struct Adaptor
+    {
+        Func make_view;
+    };
+
+    template <typename Func>
+    Adaptor<Func> make_adaptor(Func make_view)
+    {
+        return Adaptor<Func>{std::move(make_view)};
+    }
+
+    template <typename Range, typename Func>
+    auto operator|(Range &&range, Adaptor<Func> adaptor)
+    {
+        return adaptor.make_view(std::forward<Range>(range));
+    }
+
+    template <typename Pred>
+    auto filter(Pred pred)
+    {
+        return make_adaptor([pred](auto &&range)
+                            { return filter(std::forward<decltype(range)>(range), pred); });
+    }
+
+    template <typename Func>
+    auto transform(Func func)
+    {
+        return make_adaptor([func](auto &&range)
+                            { return transform(std::forward<decltype(range)>(range), func); });
+    }
+
+    inline auto take(std::size_t count)
+    {
+        return make_adaptor([count](auto &&range)
+                            { return take(std::forward<decltype(range)>(range), count); });
+    }
+
+    inline auto drop(std::size_t count)
+    {
+        return make_adaptor([count](auto &&range)
+                            { return drop(std::forward<decltype(range)>(range), count); });
+    }
+
+    inline auto chunk(std::size_t size)
+    {
+        return make_adaptor([size](auto &&range)
+                            { return chunk(std::forward<decltype(range)>(range), size); });
+    }
+}
+
+#endif
@@ -3,35 +3,80 @@
 
 #include <iostream>
 #include <string>
+#include <string_view>
 #include <sstream>
+#include "StringPool.h"
 
-#define INVALID_INDEX -1;
+#define INVALID_INDEX (-1)
 
 class SinglyNode
 {
 private:
     int index; // Index of the node in the list
 
-    std::string data; // e.g. a Name of a person
+    int access_count; // Number of successful finds of this node (used by SelfOrganizingPolicy::Count)
+
+    // Data of the node, e.g. a Name of a person; 'interned' tells which member is active
+    union
+    {
+        std::string owned_data;                     // The node's own copy of the data (not interned)
+        const StringPool::Entry *interned_data_ptr; // Entry of the data in a StringPool (interned)
+    };
 
     SinglyNode *next_node_ptr; // Pointer to the next node in the list.
 
+    bool in_list; // True while the node is linked into a list (set and reset by the lists)
+
+    bool interned; // True if the data is interned in a StringPool (stored in the padding next to 'in_list')
+
+    // Destroys the owned data, if any (the caller activates one of the data members again)
+    void release_data();
+
+    // Stores a copy of the given data in the node, which afterwards owns its data
+    void assign_owned_data(const std::string &new_data);
+
 public:
-    SinglyNode(std::string data); // Constructor
-    ~SinglyNode();                // Destructor
+    SinglyNode(std::string data);                        // Constructor (the node stores its own copy of the data)
+    SinglyNode(StringPool &pool, std::string_view data); // Constructor (the data is interned in the given pool)
+    ~SinglyNode();                                       // Destructor (releases owned data)
+
+    // Copies share interned data and copy owned data; a copy is not linked to any node
+    SinglyNode(const SinglyNode &other);
+    SinglyNode &operator=(const SinglyNode &other);
 
     // Getter und Setter für 'index'
     int get_index() const;
     void set_index(const int &index);
 
+    // Getter und Setter für 'access_count'
+    int get_access_count() const;
+    void set_access_count(const int &access_count);
+
     // Getter und Setter für 'data'
     std::string get_data() const;
-    void set_data(const std::string &new_data);
+    void set_data(const std::string &new_data);                 // The node owns the new data afterwards
+    void set_data(StringPool &pool, std::string_view new_data); // The new data is interned in the given pool
+
+    // Returns a view of the data without copying it (valid until the data is changed)
+    std::string_view get_data_view() const;
+
+    // Returns true if the data is interned in a StringPool
+    bool is_interned() const;
+
+    // Compares the data of both nodes without copying it (<0, 0 or >0 like std::string::compare)
+    int compare_data(const SinglyNode &other) const;
+
+    // Returns true if both nodes hold the same data (a pointer comparison if both are interned in the same pool)
+    bool data_equals(const SinglyNode &other) const;
 
     // Getter und Setter für 'next_node_ptr'
     SinglyNode *get_next_node_ptr() const;
     void set_next_node_ptr(SinglyNode *new_next_node_ptr);
 
+    // Getter und Setter für 'in_list'; lets a list reject a node of another list in O(1)
+    bool is_in_list() const;
+    void set_in_list(const bool &in_list);
+
     static const int node_width = 51;
     void print() const;
 };
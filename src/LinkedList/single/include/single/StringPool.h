@@ -0,0 +1,49 @@
+#ifndef STRINGPOOL_H
+#define STRINGPOOL_H
+
+/*
+Pool of interned (deduplicated) strings for the data of SinglyNodes.
+
+- Every distinct string is stored only once; interning a string again returns the same entry.
+- Nodes created with a pool store a pointer to the entry (see SinglyNode) instead of their own copy,
+  so lists with heavily repeating data (names, keys) need the memory of each distinct string only once.
+- Entries are never moved or removed, so the pointers stay valid for the lifetime of the pool.
+  The pool must outlive all nodes that use it.
+*/
+
+#include <cstddef>
+#include <deque>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+
+class StringPool
+{
+public:
+    // One interned string; nodes refer to it by pointer
+    struct Entry
+    {
+        std::string data;
+        const StringPool *pool_ptr; // Pool owning the entry (entries of the same pool are equal only if identical)
+    };
+
+private:
+    std::deque<Entry> entries; // A deque never moves its elements when growing
+
+    std::unordered_map<std::string_view, const Entry *> lookup; // Keys are views into 'entries'
+
+public:
+    StringPool();  // Constructor
+    ~StringPool(); // Destructor
+
+    StringPool(const StringPool &) = delete;
+    StringPool &operator=(const StringPool &) = delete;
+
+    // Returns the entry of the given string, adding it to the pool if it is not interned yet
+    const Entry *intern(std::string_view data);
+
+    // Returns the number of distinct strings in the pool
+    std::size_t size() const;
+};
+
+#endif
@@ -0,0 +1,386 @@
+#ifndef STATICSINGLYLINKEDLIST_H
+#define STATICSINGLYLINKEDLIST_H
+
+/*
+- static singly linked list: forwards only, fixed capacity, no heap usage
+- The values and the links are stored inline in two std::arrays of 'Capacity' slots.
+  A link is the slot number of the next node instead of a pointer.
+- Unused slots are chained in an internal free list, so push/pop/insert/remove never allocate.
+  A removed value is moved out of its slot and the slot is reset to 'T{}', so it keeps no resources of the value.
+- All methods are constexpr: with a literal type 'T' the list can be used in constant expressions (C++17).
+  Exceeding the capacity in a constant expression is a compile error, at runtime it throws std::length_error.
+
+Example structure (Capacity = 5, list = [a, b, c], slot 1 was removed before):
+
+ slot:     0     1     2     3     4
+ value:    a     -     c     b     -
+ next:     3     4     -1    2     -1
+ head_slot = 0, tail_slot = 2, free_slot = 1 -> 4
+*/
+
+#include <array>
+#include <cstddef>
+#include <iterator>
+#include <limits>
+#include <utility>
+#include "common/LinkedListErrors.h"
+
+template <typename T, std::size_t Capacity>
+class StaticSinglyLinkedList
+{
+    static_assert(Capacity > 0, "StaticSinglyLinkedList needs a capacity of at least one node");
+    static_assert(Capacity <= static_cast<std::size_t>(std::numeric_limits<int>::max()), "Capacity exceeds the range of the slot links");
+
+public:
+    // Link value marking the end of the list (or of the free list)
+    static constexpr int no_slot = -1;
+
+private:
+    std::array<T, Capacity> values; // Value of the node stored in each slot
+
+    std::array<int, Capacity> next_slots; // Slot of the next node (or next free slot) for each slot
+
+    int head_slot; // Slot of the first (head) node
+
+    int tail_slot; // Slot of the last (tail) node
+
+    int free_slot; // First slot of the free list
+
+    int node_count; // Number of nodes in the list
+
+    // Takes a slot from the free list and stores the value in it (copied or moved, depending on 'value')
+    template <typename Value>
+    constexpr int allocate_slot(Value &&value)
+    {
+        if (free_slot == no_slot)
+            LINKEDLIST_THROW(std::length_error("List is full"));
+
+        int slot = free_slot;
+        values[slot] = std::forward<Value>(value); // Before taking the slot, so a throwing assignment loses no slot
+        free_slot = next_slots[slot];
+
+        next_slots[slot] = no_slot;
+        return slot;
+    }
+
+    // Resets the value of the slot (releasing what it holds, e.g. memory) and returns the slot to the free list
+    constexpr void release_slot(int slot)
+    {
+        values[slot] = T{};
+        next_slots[slot] = free_slot;
+        free_slot = slot;
+    }
+
+    // Links the node in the given slot as the new head node
+    constexpr void link_front(int slot)
+    {
+        if (is_empty())
+            tail_slot = slot;
+        else
+            next_slots[slot] = head_slot;
+
+        head_slot = slot;
+        node_count++;
+    }
+
+    // Links the node in the given slot as the new tail node
+    constexpr void link_back(int slot)
+    {
+        if (is_empty())
+            head_slot = slot;
+        else
+            next_slots[tail_slot] = slot;
+
+        tail_slot = slot;
+        node_count++;
+    }
+
+    // Inserts a new node so that it ends up at the specified index (index == size() appends)
+    template <typename Value>
+    constexpr void insert_value(int index, Value &&value)
+    {
+        if (index < 0 || index > node_count)
+            LINKEDLIST_THROW(std::out_of_range("Index out of bounds"));
+
+        if (index == 0)
+            return link_front(allocate_slot(std::forward<Value>(value)));
+
+        if (index == node_count)
+            return link_back(allocate_slot(std::forward<Value>(value)));
+
+        int slot_before = slot_at(index - 1);
+        int slot = allocate_slot(std::forward<Value>(value));
+
+        next_slots[slot] = next_slots[slot_before];
+        next_slots[slot_before] = slot;
+        node_count++;
+    }
+
+    // Removes the node in the given slot (which is already unlinked) and returns its value
+    constexpr T take_value(int slot)
+    {
+        T value = std::move(values[slot]);
+        release_slot(slot);
+        return value;
+    }
+
+    // Returns the slot of the node at the given index, or no_slot if the index is out of range
+    constexpr int slot_at(int index) const
+    {
+        if (index < 0 || index >= node_count)
+            return no_slot;
+
+        int slot = head_slot;
+        for (int i = 0; i < index; i++)
+            slot = next_slots[slot];
+
+        return slot;
+    }
+
+public:
+    // Forward iterator over the values of the list
+    template <typename List, typename Value>
+    class BasicIterator
+    {
+    private:
+        List *list_ptr;
+        int slot;
+
+    public:
+        using iterator_category = std::forward_iterator_tag;
+        using value_type = T;
+        using difference_type = std::ptrdiff_t;
+        using pointer = Value *;
+        using reference = Value &;
+
+        constexpr BasicIterator(List *list_ptr, int slot) : list_ptr(list_ptr), slot(slot) {}
+
+        constexpr Value &operator*() const { return list_ptr->values[slot]; }
+        constexpr Value *operator->() const { return &list_ptr->values[slot]; }
+
+        constexpr BasicIterator &operator++()
+        {
+            slot = list_ptr->next_slots[slot];
+            return *this;
+        }
+
+        constexpr BasicIterator operator++(int)
+        {
+            BasicIterator previous = *this;
+            ++(*this);
+            return previous;
+        }
+
+        constexpr bool operator==(const BasicIterator &other) const { return slot == other.slot; }
+        constexpr bool operator!=(const BasicIterator &other) const { return !(*this == other); }
+    };
+
+    using iterator = BasicIterator<StaticSinglyLinkedList, T>;
+    using const_iterator = BasicIterator<const StaticSinglyLinkedList, const T>;
+
+    // Constructor: all slots are free
+    constexpr StaticSinglyLinkedList() : values{}, next_slots{}, head_slot(no_slot), tail_slot(no_slot), free_slot(0), node_count(0)
+    {
+        for (std::size_t i = 0; i < Capacity; i++)
+            next_slots[i] = i + 1 < Capacity ? static_cast<int>(i + 1) : no_slot;
+    }
+
+    // Adds a new node to the head (front) of the list
+    constexpr void push_front(const T &value)
+    {
+        link_front(allocate_slot(value));
+    }
+
+    constexpr void push_front(T &&value)
+    {
+        link_front(allocate_slot(std::move(value)));
+    }
+
+    // Adds a new node to the tail (back) of the list
+    constexpr void push_back(const T &value)
+    {
+        link_back(allocate_slot(value));
+    }
+
+    constexpr void push_back(T &&value)
+    {
+        link_back(allocate_slot(std::move(value)));
+    }
+
+    // Inserts a new node so that it ends up at the specified index (index == size() appends)
+    constexpr void insert(int index, const T &value)
+    {
+        insert_value(index, value);
+    }
+
+    constexpr void insert(int index, T &&value)
+    {
+        insert_value(index, std::move(value));
+    }
+
+    // Returns the first (head) value of the list
+    constexpr T &get_first()
+    {
+        if (is_empty())
+            LINKEDLIST_THROW(std::out_of_range("List is empty"));
+
+        return values[head_slot];
+    }
+
+    constexpr const T &get_first() const
+    {
+        if (is_empty())
+            LINKEDLIST_THROW(std::out_of_range("List is empty"));
+
+        return values[head_slot];
+    }
+
+    // Returns the last (tail) value of the list
+    constexpr T &get_last()
+    {
+        if (is_empty())
+            LINKEDLIST_THROW(std::out_of_range("List is empty"));
+
+        return values[tail_slot];
+    }
+
+    constexpr const T &get_last() const
+    {
+        if (is_empty())
+            LINKEDLIST_THROW(std::out_of_range("List is empty"));
+
+        return values[tail_slot];
+    }
+
+    // Returns the value at the given index
+    constexpr T &get(int index)
+    {
+        int slot = slot_at(index);
+
+        if (slot == no_slot)
+            LINKEDLIST_THROW(std::out_of_range("Index out of range"));
+
+        return values[slot];
+    }
+
+    constexpr const T &get(int index) const
+    {
+        int slot = slot_at(index);
+
+        if (slot == no_slot)
+            LINKEDLIST_THROW(std::out_of_range("Index out of range"));
+
+        return values[slot];
+    }
+
+    // Returns a pointer to the value at the given index, or nullptr if the index is out of range
+    constexpr T *try_get(int index)
+    {
+        int slot = slot_at(index);
+        return slot == no_slot ? nullptr : &values[slot];
+    }
+
+    // Removes the head node of the list and returns its value
+    constexpr T pop_front()
+    {
+        if (is_empty())
+            LINKEDLIST_THROW(std::out_of_range("List is empty"));
+
+        int slot = head_slot;
+        head_slot = next_slots[slot];
+
+        if (head_slot == no_slot)
+            tail_slot = no_slot;
+
+        node_count--;
+
+        return take_value(slot);
+    }
+
+    // Removes the tail node of the list and returns its value
+    constexpr T pop_back()
+    {
+        if (is_empty())
+            LINKEDLIST_THROW(std::out_of_range("List is empty"));
+
+        if (node_count == 1)
+            return pop_front();
+
+        // Singly linked: the node before the tail has to be searched
+        int slot_before = slot_at(node_count - 2);
+        int slot = tail_slot;
+
+        next_slots[slot_before] = no_slot;
+        tail_slot = slot_before;
+        node_count--;
+
+        return take_value(slot);
+    }
+
+    // Removes the node at the specified index and returns its value
+    constexpr T remove(int index)
+    {
+        if (index < 0 || index >= node_count)
+            LINKEDLIST_THROW(std::out_of_range("Index out of bounds"));
+
+        if (index == 0)
+            return pop_front();
+
+        int slot_before = slot_at(index - 1);
+        int slot = next_slots[slot_before];
+
+        next_slots[slot_before] = next_slots[slot];
+        if (slot == tail_slot)
+            tail_slot = slot_before;
+
+        node_count--;
+
+        return take_value(slot);
+    }
+
+    // Returns true if the list is empty
+    constexpr bool is_empty() const
+    {
+        return node_count == 0;
+    }
+
+    // Returns true if all slots are used
+    constexpr bool is_full() const
+    {
+        return node_count == static_cast<int>(Capacity);
+    }
+
+    // Returns the number of nodes in the list
+    constexpr int size() const
+    {
+        return node_count;
+    }
+
+    // Returns the maximum number of nodes in the list
+    static constexpr int capacity()
+    {
+        return static_cast<int>(Capacity);
+    }
+
+    // Removes all nodes from the list (their values are reset, see release_slot())
+    constexpr void clear()
+    {
+        while (head_slot != no_slot)
+        {
+            int slot = head_slot;
+            head_slot = next_slots[slot];
+            release_slot(slot);
+        }
+
+        tail_slot = no_slot;
+        node_count = 0;
+    }
+
+    // Iterators for range-for loops
+    constexpr iterator begin() { return iterator(this, head_slot); }
+    constexpr iterator end() { return iterator(this, no_slot); }
+    constexpr const_iterator begin() const { return const_iterator(this, head_slot); }
+    constexpr const_iterator end() const { return const_iterator(this, no_slot); }
+};
+
+#endif
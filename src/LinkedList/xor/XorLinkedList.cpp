@@ -0,0 +1,224 @@
+#include "xor/XorLinkedList.h"
+
+XorLinkedList::Iterator::Iterator(XorNode *prev_node_ptr, XorNode *current_node_ptr)
+{
+    this->prev_node_ptr = prev_node_ptr;
+    this->current_node_ptr = current_node_ptr;
+}
+
+XorNode &XorLinkedList::Iterator::operator*() const
+{
+    return *current_node_ptr;
+}
+
+XorNode *XorLinkedList::Iterator::operator->() const
+{
+    return current_node_ptr;
+}
+
+XorLinkedList::Iterator &XorLinkedList::Iterator::operator++()
+{
+    // The next node is the neighbour of the current node that is not the previous node
+    XorNode *next_node_ptr = current_node_ptr->get_other_node_ptr(prev_node_ptr);
+
+    prev_node_ptr = current_node_ptr;
+    current_node_ptr = next_node_ptr;
+    return *this;
+}
+
+XorLinkedList::Iterator XorLinkedList::Iterator::operator++(int)
+{
+    Iterator previous = *this;
+    ++(*this);
+    return previous;
+}
+
+XorLinkedList::Iterator &XorLinkedList::Iterator::operator--()
+{
+    // Step back: the previous node becomes current; its other neighbour becomes the new previous node
+    XorNode *new_prev_node_ptr = prev_node_ptr->get_other_node_ptr(current_node_ptr);
+
+    current_node_ptr = prev_node_ptr;
+    prev_node_ptr = new_prev_node_ptr;
+    return *this;
+}
+
+XorLinkedList::Iterator XorLinkedList::Iterator::operator--(int)
+{
+    Iterator previous = *this;
+    --(*this);
+    return previous;
+}
+
+bool XorLinkedList::Iterator::operator==(const Iterator &other) const
+{
+    return current_node_ptr == other.current_node_ptr;
+}
+
+bool XorLinkedList::Iterator::operator!=(const Iterator &other) const
+{
+    return !(*this == other);
+}
+
+XorLinkedList::XorLinkedList()
+{
+    head_node_ptr = nullptr;
+    tail_node_ptr = nullptr;
+    node_count = 0;
+}
+
+XorLinkedList::~XorLinkedList()
+{
+    clear(); // The pool releases the memory, but the nodes (and their strings) have to be destroyed first
+}
+
+void XorLinkedList::push_front(std::string data)
+{
+    XorNode *new_node = node_pool.create(std::move(data));
+
+    if (is_empty())
+    {
+        new_node->set_link(nullptr, nullptr);
+        tail_node_ptr = new_node;
+    }
+    else
+    {
+        new_node->set_link(nullptr, head_node_ptr);
+        head_node_ptr->replace_neighbour(nullptr, new_node); // The old head node now has a previous node
+    }
+
+    head_node_ptr = new_node;
+    node_count++;
+}
+
+void XorLinkedList::push_back(std::string data)
+{
+    XorNode *new_node = node_pool.create(std::move(data));
+
+    if (is_empty())
+    {
+        new_node->set_link(nullptr, nullptr);
+        head_node_ptr = new_node;
+    }
+    else
+    {
+        new_node->set_link(tail_node_ptr, nullptr);
+        tail_node_ptr->replace_neighbour(nullptr, new_node); // The old tail node now has a next node
+    }
+
+    tail_node_ptr = new_node;
+    node_count++;
+}
+
+XorNode &XorLinkedList::get_first() const
+{
+    if (is_empty())
+        LINKEDLIST_THROW(std::out_of_range("List is empty"));
+
+    return *head_node_ptr;
+}
+
+XorNode &XorLinkedList::get_last() const
+{
+    if (is_empty())
+        LINKEDLIST_THROW(std::out_of_range("List is empty"));
+
+    return *tail_node_ptr;
+}
+
+std::string XorLinkedList::pop_front()
+{
+    if (is_empty())
+        LINKEDLIST_THROW(std::out_of_range("List is empty"));
+
+    XorNode *removed_node = head_node_ptr;
+    XorNode *new_head_node_ptr = removed_node->get_other_node_ptr(nullptr); // nullptr if it was the only node
+
+    if (new_head_node_ptr != nullptr)
+        new_head_node_ptr->replace_neighbour(removed_node, nullptr);
+    else
+        tail_node_ptr = nullptr;
+
+    head_node_ptr = new_head_node_ptr;
+    node_count--;
+
+    std::string data = removed_node->get_data();
+    node_pool.destroy(removed_node);
+    return data;
+}
+
+std::string XorLinkedList::pop_back()
+{
+    if (is_empty())
+        LINKEDLIST_THROW(std::out_of_range("List is empty"));
+
+    XorNode *removed_node = tail_node_ptr;
+    XorNode *new_tail_node_ptr = removed_node->get_other_node_ptr(nullptr);
+
+    if (new_tail_node_ptr != nullptr)
+        new_tail_node_ptr->replace_neighbour(removed_node, nullptr);
+    else
+        head_node_ptr = nullptr;
+
+    tail_node_ptr = new_tail_node_ptr;
+    node_count--;
+
+    std::string data = removed_node->get_data();
+    node_pool.destroy(removed_node);
+    return data;
+}
+
+bool XorLinkedList::is_empty() const
+{
+    return head_node_ptr == nullptr;
+}
+
+int XorLinkedList::size() const
+{
+    return node_count;
+}
+
+void XorLinkedList::clear()
+{
+    XorNode *prev_node_ptr = nullptr;
+    XorNode *current_node = head_node_ptr;
+
+    while (current_node != nullptr)
+    {
+        XorNode *next_node_ptr = current_node->get_other_node_ptr(prev_node_ptr);
+
+        node_pool.destroy(current_node); // The slot is reused by later push operations
+
+        prev_node_ptr = current_node; // Only the address is needed to decode the next link
+        current_node = next_node_ptr;
+    }
+
+    head_node_ptr = nullptr;
+    tail_node_ptr = nullptr;
+    node_count = 0;
+}
+
+std::size_t XorLinkedList::allocated_bytes() const
+{
+    return node_pool.allocated_bytes();
+}
+
+XorLinkedList::Iterator XorLinkedList::begin() const
+{
+    return Iterator(nullptr, head_node_ptr);
+}
+
+XorLinkedList::Iterator XorLinkedList::end() const
+{
+    return Iterator(tail_node_ptr, nullptr); // One past the tail node; decrementing yields the tail node
+}
+
+XorLinkedList::Iterator XorLinkedList::rbegin() const
+{
+    return Iterator(nullptr, tail_node_ptr);
+}
+
+XorLinkedList::Iterator XorLinkedList::rend() const
+{
+    return Iterator(head_node_ptr, nullptr);
+}
@@ -0,0 +1,39 @@
+#include "xor/XorNode.h"
+
+#include <utility>
+
+XorNode::XorNode(std::string data) noexcept
+{
+    this->data = std::move(data); // The argument is already a copy
+    this->link = 0; // No neighbours yet
+}
+
+XorNode::~XorNode()
+{
+}
+
+std::string XorNode::get_data() const
+{
+    return std::string(this->data);
+}
+
+void XorNode::set_data(const std::string &new_data)
+{
+    this->data = new_data;
+}
+
+XorNode *XorNode::get_other_node_ptr(const XorNode *neighbour_node_ptr) const
+{
+    return reinterpret_cast<XorNode *>(this->link ^ reinterpret_cast<std::uintptr_t>(neighbour_node_ptr));
+}
+
+void XorNode::set_link(const XorNode *prev_node_ptr, const XorNode *next_node_ptr)
+{
+    this->link = reinterpret_cast<std::uintptr_t>(prev_node_ptr) ^ reinterpret_cast<std::uintptr_t>(next_node_ptr);
+}
+
+void XorNode::replace_neighbour(const XorNode *old_node_ptr, const XorNode *new_node_ptr)
+{
+    // XOR-ing the old neighbour out and the new neighbour in leaves the other neighbour untouched
+    this->link ^= reinterpret_cast<std::uintptr_t>(old_node_ptr) ^ reinterpret_cast<std::uintptr_t>(new_node_ptr);
+}
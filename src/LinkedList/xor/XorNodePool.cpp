@@ -0,0 +1,66 @@
+#include "xor/XorNodePool.h"
+
+#include <new>
+#include <type_traits>
+#include <utility>
+
+XorNodePool::XorNodePool(std::size_t nodes_per_block)
+{
+    this->nodes_per_block = nodes_per_block > 0 ? nodes_per_block : 1;
+    this->used_in_last_block = this->nodes_per_block; // Forces the allocation of a block on the first create()
+    this->free_slot_ptr = nullptr;
+}
+
+XorNodePool::~XorNodePool()
+{
+    // The blocks are released by the unique_ptrs; the owner (list) destroys the nodes before
+}
+
+XorNode *XorNodePool::create(std::string data)
+{
+    // The data was copied into the argument by the caller; moving it into the node cannot fail halfway
+    static_assert(std::is_nothrow_constructible<XorNode, std::string &&>::value, "Constructing a node must not throw");
+
+    if (free_slot_ptr != nullptr)
+    {
+        // Reuse the slot of a destroyed node; the node overwrites the free list link, so read it first
+        Slot *slot = free_slot_ptr;
+        Slot *next_free_slot_ptr = slot->next_free_slot_ptr;
+
+        XorNode *node_ptr = new (slot->storage) XorNode(std::move(data)); // Placement new: construct the node inside the slot
+
+        free_slot_ptr = next_free_slot_ptr; // Take the slot only after the node is constructed
+        return node_ptr;
+    }
+
+    if (used_in_last_block == nodes_per_block)
+    {
+        // Last block is full, allocate a new one (existing blocks are not moved)
+        std::unique_ptr<Slot[]> block(new Slot[nodes_per_block]);
+        blocks.push_back(std::move(block)); // The block is released if push_back() fails
+        used_in_last_block = 0;
+    }
+
+    XorNode *node_ptr = new (blocks.back()[used_in_last_block].storage) XorNode(std::move(data));
+
+    used_in_last_block++; // Take the slot only after the node is constructed
+    return node_ptr;
+}
+
+void XorNodePool::destroy(XorNode *node_ptr)
+{
+    if (node_ptr == nullptr)
+        return;
+
+    node_ptr->~XorNode();
+
+    // The node occupied the whole slot, so its address is the address of the slot
+    Slot *slot = reinterpret_cast<Slot *>(node_ptr);
+    slot->next_free_slot_ptr = free_slot_ptr;
+    free_slot_ptr = slot;
+}
+
+std::size_t XorNodePool::allocated_bytes() const
+{
+    return blocks.size() * nodes_per_block * sizeof(Slot);
+}
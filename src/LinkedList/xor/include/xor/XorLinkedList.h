@@ -0,0 +1,110 @@
+#ifndef XORLINKEDLIST_H
+#define XORLINKEDLIST_H
+
+/*
+- XOR linked list: forwards and backwards like a doubly linked list,
+  but with only one link word per node (see "XorNode.h")
+- The list owns its nodes; they are allocated from a XorNodePool so their addresses stay valid
+*/
+
+#include <cstddef>
+#include <iterator>
+#include <string>
+#include "common/LinkedListErrors.h"
+#include "XorNode.h"
+#include "XorNodePool.h"
+
+class XorLinkedList
+{
+private:
+    // Pointer to the first (head) node in the list
+    XorNode *head_node_ptr;
+
+    // Pointer to the last (tail) node in the list
+    XorNode *tail_node_ptr;
+
+    // Number of nodes in the list (there are no per-node indexes to save memory)
+    int node_count;
+
+    // Allocator owning the memory of all nodes
+    XorNodePool node_pool;
+
+public:
+    /*
+    Bidirectional iterator over the nodes of the list.
+    A XOR link can only be followed when the neighbour we came from is known,
+    therefore the iterator stores the current and the previous node.
+    */
+    class Iterator
+    {
+    private:
+        XorNode *prev_node_ptr;
+        XorNode *current_node_ptr;
+
+    public:
+        using iterator_category = std::bidirectional_iterator_tag;
+        using value_type = XorNode;
+        using difference_type = std::ptrdiff_t;
+        using pointer = XorNode *;
+        using reference = XorNode &;
+
+        Iterator(XorNode *prev_node_ptr = nullptr, XorNode *current_node_ptr = nullptr);
+
+        XorNode &operator*() const;
+        XorNode *operator->() const;
+
+        Iterator &operator++();   // Prefix increment (towards the end the iterator was started for)
+        Iterator operator++(int); // Postfix increment
+        Iterator &operator--();   // Prefix decrement
+        Iterator operator--(int); // Postfix decrement
+
+        bool operator==(const Iterator &other) const;
+        bool operator!=(const Iterator &other) const;
+    };
+
+    XorLinkedList();  // Constructor
+    ~XorLinkedList(); // Destructor
+
+    XorLinkedList(const XorLinkedList &) = delete;
+    XorLinkedList &operator=(const XorLinkedList &) = delete;
+
+    // Adds a new node with the given data to the head (front) of the list (the data is moved into the node)
+    void push_front(std::string data);
+
+    // Adds a new node with the given data to the tail (back) of the list (the data is moved into the node)
+    void push_back(std::string data);
+
+    // Returns the first (head) node of the list
+    XorNode &get_first() const;
+
+    // Returns the last (tail) node of the list
+    XorNode &get_last() const;
+
+    // Removes the head node of the list and returns its data
+    std::string pop_front();
+
+    // Removes the tail node of the list and returns its data
+    std::string pop_back();
+
+    // Returns true if the list is empty
+    bool is_empty() const;
+
+    // Returns the number of nodes in the list
+    int size() const;
+
+    // Removes and destroys all nodes of the list
+    void clear();
+
+    // Returns the number of bytes allocated for the nodes
+    std::size_t allocated_bytes() const;
+
+    // Forward iteration: head -> tail
+    Iterator begin() const;
+    Iterator end() const;
+
+    // Backward iteration: tail -> head (incrementing a reverse iterator moves towards the head)
+    Iterator rbegin() const;
+    Iterator rend() const;
+};
+
+#endif
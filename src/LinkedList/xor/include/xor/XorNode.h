@@ -0,0 +1,43 @@
+#ifndef XORNODE_H
+#define XORNODE_H
+
+#include <cstdint>
+#include <string>
+
+/*
+Node of a XOR linked list.
+
+Instead of a 'prev_node_ptr' and a 'next_node_ptr' the node stores a single link word:
+
+    link = address of the previous node XOR address of the next node
+
+Knowing the address of one neighbour, the other neighbour is recovered with 'link XOR neighbour'.
+This allows traversal in both directions with the memory footprint of a singly linked node.
+*/
+
+class XorNode
+{
+private:
+    std::string data; // e.g. a Name of a person
+
+    std::uintptr_t link; // Address of the previous node XOR address of the next node (nullptr = 0)
+
+public:
+    XorNode(std::string data) noexcept; // Constructor (moves the data in, so it cannot throw)
+    ~XorNode();                         // Destructor
+
+    // Getter und Setter für 'data'
+    std::string get_data() const;
+    void set_data(const std::string &new_data);
+
+    // Returns the neighbour on the other side of the given neighbour (pass nullptr at the ends of the list)
+    XorNode *get_other_node_ptr(const XorNode *neighbour_node_ptr) const;
+
+    // Sets the link to the given previous and next node
+    void set_link(const XorNode *prev_node_ptr, const XorNode *next_node_ptr);
+
+    // Replaces the neighbour 'old_node_ptr' with 'new_node_ptr' and keeps the other neighbour
+    void replace_neighbour(const XorNode *old_node_ptr, const XorNode *new_node_ptr);
+};
+
+#endif
@@ -0,0 +1,58 @@
+#ifndef XORNODEPOOL_H
+#define XORNODEPOOL_H
+
+#include <cstddef>
+#include <memory>
+#include <string>
+#include <vector>
+#include "XorNode.h"
+
+/*
+Allocator for the nodes of a XorLinkedList.
+
+- Nodes are created in blocks of 'nodes_per_block' slots, so one heap allocation serves many nodes
+  and there is no per-node allocation header.
+- Blocks are never moved or released before the pool is destroyed, so the address of a node
+  (which is stored XOR-ed in its neighbours) stays valid for the whole lifetime of the node.
+- Destroyed nodes are put on a free list and their slots are reused by the next created nodes.
+*/
+
+class XorNodePool
+{
+private:
+    // Storage for exactly one node; a free slot stores the pointer to the next free slot instead
+    union Slot
+    {
+        Slot *next_free_slot_ptr;
+        alignas(XorNode) unsigned char storage[sizeof(XorNode)];
+    };
+
+    std::size_t nodes_per_block;
+
+    std::vector<std::unique_ptr<Slot[]>> blocks; // All allocated blocks
+
+    std::size_t used_in_last_block; // Number of slots handed out from the last block
+
+    Slot *free_slot_ptr; // Head of the free list (slots of destroyed nodes)
+
+public:
+    static const std::size_t default_nodes_per_block = 256;
+
+    XorNodePool(std::size_t nodes_per_block = default_nodes_per_block); // Constructor
+    ~XorNodePool();                                                    // Destructor (nodes must be destroyed before)
+
+    XorNodePool(const XorNodePool &) = delete;
+    XorNodePool &operator=(const XorNodePool &) = delete;
+
+    // Constructs a new node in a free slot and returns its (stable) address (the data is moved into the node).
+    // A slot is only taken once its node is constructed, so a failing allocation of a block loses no slot
+    XorNode *create(std::string data);
+
+    // Destructs the given node and releases its slot for reuse
+    void destroy(XorNode *node_ptr);
+
+    // Returns the number of bytes allocated for blocks
+    std::size_t allocated_bytes() const;
+};
+
+#endif
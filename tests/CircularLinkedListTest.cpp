@@ -0,0 +1,331 @@
+#include <gtest/gtest.h>
+#include "circular/CircularDoublyLinkedList.h"
+#include "circular/CircularSinglyLinkedList.h"
+#include "single/SinglyLinkedList.h"
+#include "LinkedListTestMacros.h"
+
+// Returns the data of 'rounds' full rounds starting at the cursor, concatenated (the cursor ends where it started)
+template <typename List>
+std::string round_robin(List &list, int rounds = 1)
+{
+    std::string joined;
+    for (int i = 0; i < list.size() * rounds; i++)
+    {
+        joined += list.get_current().get_data();
+        list.advance();
+    }
+
+    return joined;
+}
+
+TEST(CircularSinglyLinkedListTests, InsertBeforeCursorTest)
+{
+    CircularSinglyLinkedList c_list;
+    SinglyNode node_a("A"), node_b("B"), node_c("C");
+
+    ASSERT_EQ(c_list.is_empty(), true);
+
+    c_list.insert_before_cursor(node_a);
+    ASSERT_EQ(&c_list.get_current(), &node_a);
+    ASSERT_EQ(node_a.get_next_node_ptr(), &node_a); // A single node points to itself
+
+    // New nodes are queued at the end of the current round
+    c_list.insert_before_cursor(node_b);
+    c_list.insert_before_cursor(node_c);
+
+    ASSERT_EQ(c_list.size(), 3);
+    ASSERT_EQ(round_robin(c_list, 2), "ABCABC");
+    ASSERT_EQ(node_c.get_next_node_ptr(), &node_a); // The ring is closed
+}
+
+TEST(CircularSinglyLinkedListTests, InsertAfterCursorTest)
+{
+    CircularSinglyLinkedList c_list;
+    SinglyNode node_a("A"), node_b("B"), node_c("C"), node_d("D"), node_e("E");
+
+    c_list.insert_after_cursor(node_a);
+    ASSERT_EQ(&c_list.get_current(), &node_a);
+    ASSERT_EQ(node_a.get_next_node_ptr(), &node_a);
+
+    c_list.insert_after_cursor(node_c); // Next node after the current one
+    c_list.insert_after_cursor(node_b);
+    c_list.insert_before_cursor(node_d); // Last node of the round
+
+    ASSERT_EQ(c_list.size(), 4);
+    ASSERT_EQ(round_robin(c_list, 2), "ABCDABCD");
+    ASSERT_EQ(node_d.get_next_node_ptr(), &node_a);
+
+    // The cursor is still in front of the inserted node, so it can be removed next
+    c_list.advance(3);
+    c_list.insert_after_cursor(node_e);
+    ASSERT_EQ(c_list.get_current().get_data(), "D");
+    c_list.advance();
+    ASSERT_EQ(c_list.remove_current().get_data(), "E");
+    ASSERT_EQ(round_robin(c_list), "ABCD");
+}
+
+TEST(CircularSinglyLinkedListTests, AdvanceTest)
+{
+    CircularSinglyLinkedList c_list;
+    SinglyNode node_a("A"), node_b("B"), node_c("C");
+
+    c_list.insert_before_cursor(node_a);
+    c_list.insert_before_cursor(node_b);
+    c_list.insert_before_cursor(node_c);
+
+    c_list.advance(2);
+    ASSERT_EQ(c_list.get_current().get_data(), "C");
+
+    c_list.advance(7); // Full rounds are skipped
+    ASSERT_EQ(c_list.get_current().get_data(), "A");
+
+    c_list.advance(-1);
+    ASSERT_EQ(c_list.get_current().get_data(), "C");
+
+    c_list.advance(-5);
+    ASSERT_EQ(c_list.get_current().get_data(), "A");
+
+    c_list.advance(0);
+    ASSERT_EQ(c_list.get_current().get_data(), "A");
+}
+
+TEST(CircularSinglyLinkedListTests, RemoveCurrentTest)
+{
+    CircularSinglyLinkedList c_list;
+    SinglyNode node_a("A"), node_b("B"), node_c("C");
+
+    c_list.insert_before_cursor(node_a);
+    c_list.insert_before_cursor(node_b);
+    c_list.insert_before_cursor(node_c);
+    c_list.advance();
+
+    // The next node becomes the current node
+    ASSERT_EQ(&c_list.remove_current(), &node_b);
+    ASSERT_EQ(node_b.get_next_node_ptr(), nullptr);
+    ASSERT_EQ(c_list.size(), 2);
+    ASSERT_EQ(round_robin(c_list), "CA");
+
+    // A removed node can be inserted again
+    c_list.insert_before_cursor(node_b);
+    ASSERT_EQ(round_robin(c_list), "CAB");
+
+    ASSERT_EQ(&c_list.remove_current(), &node_c);
+    ASSERT_EQ(&c_list.remove_current(), &node_a);
+    ASSERT_EQ(&c_list.remove_current(), &node_b);
+    ASSERT_EQ(c_list.is_empty(), true);
+    ASSERT_EQ(c_list.size(), 0);
+}
+
+TEST(CircularSinglyLinkedListTests, RoundRobinSchedulerTest)
+{
+    // Tasks from a SinglyLinkedList are moved into the ring; each turn runs the current task and finished tasks are removed
+    SinglyLinkedList s_list;
+    SinglyNode task_a("A"), task_b("B"), task_c("C");
+    s_list.push_back(task_a);
+    s_list.push_back(task_b);
+    s_list.push_back(task_c);
+
+    CircularSinglyLinkedList scheduler;
+    while (!s_list.is_empty())
+        scheduler.insert_before_cursor(s_list.pop_front());
+
+    std::string runs;
+    std::string finished;
+    int turn = 0;
+
+    while (!scheduler.is_empty())
+    {
+        runs += scheduler.get_current().get_data();
+
+        // Every third turn the current task finishes
+        if (++turn % 3 == 0)
+            finished += scheduler.remove_current().get_data();
+        else
+            scheduler.advance();
+    }
+
+    ASSERT_EQ(runs, "ABCABABBB");
+    ASSERT_EQ(finished, "CAB");
+}
+
+TEST(CircularSinglyLinkedListTests, ClearTest)
+{
+    CircularSinglyLinkedList c_list;
+    SinglyNode node_a("A"), node_b("B");
+
+    c_list.insert_before_cursor(node_a);
+    c_list.insert_before_cursor(node_b);
+    c_list.clear();
+
+    ASSERT_EQ(c_list.is_empty(), true);
+    ASSERT_EQ(node_a.get_next_node_ptr(), nullptr);
+    ASSERT_EQ(node_b.get_next_node_ptr(), nullptr);
+}
+
+TEST(CircularSinglyLinkedListTests, ExceptionTest)
+{
+    CircularSinglyLinkedList c_list;
+    SinglyNode node_a("A");
+
+    ASSERT_LIST_THROW(c_list.get_current(), std::out_of_range);
+    ASSERT_LIST_THROW(c_list.remove_current(), std::out_of_range);
+
+    c_list.insert_before_cursor(node_a);
+    ASSERT_LIST_THROW(c_list.insert_before_cursor(node_a), std::runtime_error);
+    ASSERT_EQ(c_list.size(), 1);
+}
+
+TEST(CircularSinglyLinkedListTests, NodeOfLinearListTest)
+{
+    SinglyLinkedList s_list;
+    SinglyNode node_a("A"), node_b("B"), node_c("C");
+    s_list.push_back(node_a);
+    s_list.push_back(node_b);
+    s_list.push_back(node_c);
+
+    CircularSinglyLinkedList c_list;
+
+    // The tail of a linear list has no next node, but is still part of the list
+    ASSERT_LIST_THROW(c_list.insert_before_cursor(node_c), std::runtime_error);
+    ASSERT_LIST_THROW(c_list.insert_before_cursor(node_a), std::runtime_error);
+    ASSERT_EQ(c_list.is_empty(), true);
+    ASSERT_EQ(node_c.get_next_node_ptr(), nullptr);
+    ASSERT_EQ(s_list.size(), 3);
+
+    // Nodes of a ring cannot be added to a linear list either
+    SinglyNode node_d("D");
+    c_list.insert_before_cursor(node_d);
+    ASSERT_LIST_THROW(s_list.push_back(node_d), std::runtime_error);
+
+    // Nodes of a cleared list can be inserted into the ring
+    s_list.clear();
+    ASSERT_EQ(node_a.get_next_node_ptr(), nullptr);
+    c_list.insert_before_cursor(node_a);
+    c_list.insert_before_cursor(node_b);
+    c_list.insert_before_cursor(node_c);
+    ASSERT_EQ(round_robin(c_list), "DABC");
+
+    // Ring nodes have no index, also if they had one in the linear list before
+    ASSERT_EQ(node_c.get_index(), INVALID_INDEX);
+    ASSERT_EQ(c_list.get_current().get_index(), INVALID_INDEX);
+
+    // ... and back into a linear list once they are removed from the ring
+    c_list.clear();
+    s_list.push_back(node_c);
+    s_list.push_back(node_d);
+    ASSERT_EQ(s_list.size(), 2);
+    ASSERT_EQ(node_d.get_next_node_ptr(), nullptr);
+    ASSERT_EQ(node_d.get_index(), 1);
+
+    // A node popped from the back of a linear list loses its index as well
+    ASSERT_EQ(&s_list.pop_back(), &node_d);
+    ASSERT_EQ(node_d.get_index(), INVALID_INDEX);
+    c_list.insert_before_cursor(node_d);
+    ASSERT_EQ(c_list.get_current().get_index(), INVALID_INDEX);
+
+    ASSERT_EQ(&s_list.pop_front(), &node_c);
+    ASSERT_EQ(node_c.get_index(), INVALID_INDEX);
+    c_list.insert_before_cursor(node_c);
+    ASSERT_EQ(c_list.remove_current().get_index(), INVALID_INDEX);
+}
+
+TEST(CircularDoublyLinkedListTests, InsertTest)
+{
+    CircularDoublyLinkedList c_list;
+    DoublyNode node_a("A"), node_b("B"), node_c("C"), node_d("D");
+
+    ASSERT_EQ(c_list.is_empty(), true);
+
+    c_list.insert_after_cursor(node_a);
+    ASSERT_EQ(&c_list.get_current(), &node_a);
+    ASSERT_EQ(node_a.get_next_node_ptr(), &node_a);
+    ASSERT_EQ(node_a.get_prev_node_ptr(), &node_a);
+
+    c_list.insert_before_cursor(node_d); // Last node of the round
+    c_list.insert_after_cursor(node_c);  // Next node after the current one
+    c_list.insert_after_cursor(node_b);
+
+    ASSERT_EQ(c_list.size(), 4);
+    ASSERT_EQ(round_robin(c_list, 2), "ABCDABCD");
+    ASSERT_EQ(node_a.get_prev_node_ptr(), &node_d);
+    ASSERT_EQ(node_d.get_next_node_ptr(), &node_a);
+}
+
+TEST(CircularDoublyLinkedListTests, AdvanceTest)
+{
+    CircularDoublyLinkedList c_list;
+    DoublyNode node_a("A"), node_b("B"), node_c("C");
+
+    c_list.insert_before_cursor(node_a);
+    c_list.insert_before_cursor(node_b);
+    c_list.insert_before_cursor(node_c);
+
+    c_list.advance(-1);
+    ASSERT_EQ(c_list.get_current().get_data(), "C");
+
+    c_list.advance(-7);
+    ASSERT_EQ(c_list.get_current().get_data(), "B");
+
+    c_list.advance(4);
+    ASSERT_EQ(c_list.get_current().get_data(), "C");
+
+    // Walking backwards visits the nodes in reverse order
+    std::string backwards;
+    for (int i = 0; i < c_list.size(); i++)
+    {
+        backwards += c_list.get_current().get_data();
+        c_list.advance(-1);
+    }
+    ASSERT_EQ(backwards, "CBA");
+}
+
+TEST(CircularDoublyLinkedListTests, RemoveCurrentTest)
+{
+    CircularDoublyLinkedList c_list;
+    DoublyNode node_a("A"), node_b("B"), node_c("C");
+
+    c_list.insert_before_cursor(node_a);
+    c_list.insert_before_cursor(node_b);
+    c_list.insert_before_cursor(node_c);
+    c_list.advance();
+
+    ASSERT_EQ(&c_list.remove_current(), &node_b);
+    ASSERT_EQ(node_b.get_next_node_ptr(), nullptr);
+    ASSERT_EQ(node_b.get_prev_node_ptr(), nullptr);
+    ASSERT_EQ(node_a.get_next_node_ptr(), &node_c);
+    ASSERT_EQ(node_c.get_prev_node_ptr(), &node_a);
+    ASSERT_EQ(round_robin(c_list), "CA");
+
+    ASSERT_EQ(&c_list.remove_current(), &node_c);
+    ASSERT_EQ(&c_list.remove_current(), &node_a);
+    ASSERT_EQ(c_list.is_empty(), true);
+
+    // Removed nodes can be inserted again
+    c_list.insert_before_cursor(node_c);
+    c_list.insert_before_cursor(node_b);
+    ASSERT_EQ(round_robin(c_list), "CB");
+
+    c_list.clear();
+    ASSERT_EQ(c_list.is_empty(), true);
+    ASSERT_EQ(node_c.get_next_node_ptr(), nullptr);
+}
+
+TEST(CircularDoublyLinkedListTests, ExceptionTest)
+{
+    CircularDoublyLinkedList c_list;
+    DoublyNode node_a("A");
+
+    ASSERT_LIST_THROW(c_list.get_current(), std::out_of_range);
+    ASSERT_LIST_THROW(c_list.remove_current(), std::out_of_range);
+
+    c_list.insert_before_cursor(node_a);
+    ASSERT_LIST_THROW(c_list.insert_before_cursor(node_a), std::runtime_error);
+    ASSERT_LIST_THROW(c_list.insert_after_cursor(node_a), std::runtime_error);
+    ASSERT_EQ(c_list.size(), 1);
+}
+
+int main(int argc, char **argv)
+{
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -0,0 +1,13 @@
+#ifndef LINKEDLISTTESTMACROS_H
+#define LINKEDLISTTESTMACROS_H
+
+#include <gtest/gtest.h>
+
+// Without exception support the library aborts instead of throwing
+#ifdef LINKEDLIST_NO_EXCEPTIONS
+#define ASSERT_LIST_THROW(statement, exception) ASSERT_DEATH(statement, "")
+#else
+#define ASSERT_LIST_THROW(statement, exception) ASSERT_THROW(statement, exception)
+#endif
+
+#endif
@@ -1,6 +1,14 @@
 #include <gtest/gtest.h>
+#include <memory>
+#include <set>
+#include <thread>
+#include <vector>
 #include "single/SinglyLinkedList.h"
 #include "single/SinglyNode.h"
+#include "single/ShardedSinglyLinkedList.h"
+#include "single/SinglyLinkedListViews.h"
+#include "single/StringPool.h"
+#include "LinkedListTestMacros.h"
 
 TEST(SinglyLinkedListTests, ClearTest)
 {
@@ -27,9 +35,24 @@ TEST(SinglyLinkedListTests, ClearTest)
     // Assert
     ASSERT_EQ(s_list.is_empty(), true);
     ASSERT_EQ(s_list.size(), 0);
-    ASSERT_THROW(s_list.get_first(), std::out_of_range);
-    ASSERT_THROW(s_list.get_last(), std::out_of_range);
-    ASSERT_THROW(s_list.get_node(0), std::out_of_range);
+    ASSERT_LIST_THROW(s_list.get_first(), std::out_of_range);
+    ASSERT_LIST_THROW(s_list.get_last(), std::out_of_range);
+    ASSERT_LIST_THROW(s_list.get_node(0), std::out_of_range);
+
+    // The nodes are unlinked and can be added to another list
+    ASSERT_EQ(first_node.get_next_node_ptr(), nullptr);
+    ASSERT_EQ(second_node.is_in_list(), false);
+    ASSERT_EQ(third_node.get_index(), INVALID_INDEX);
+
+    SinglyLinkedList other_list;
+    other_list.push_back(second_node);
+    other_list.push_back(first_node);
+    ASSERT_EQ(other_list.size(), 2);
+
+    // A node can only be in one list at a time
+    ASSERT_LIST_THROW(s_list.push_back(first_node), std::runtime_error);
+    ASSERT_LIST_THROW(s_list.push_front(second_node), std::runtime_error);
+    ASSERT_EQ(s_list.is_empty(), true);
 }
 
 TEST(SinglyLinkedListTests, IsEmptyTest)
@@ -111,18 +134,18 @@ TEST(SinglyLinkedListTests, OutOfRangeTests)
     SinglyLinkedList s_list; // Empty list at the beginning
 
     // Assert that accessing elements or performing operations on an empty list
-    ASSERT_THROW(s_list.get_first(), std::out_of_range);
-    ASSERT_THROW(s_list.get_last(), std::out_of_range);
-    ASSERT_THROW(s_list.get_node(5), std::out_of_range);
-    ASSERT_THROW(s_list.pop_front(), std::out_of_range);
-    ASSERT_THROW(s_list.pop_back(), std::out_of_range);
-    ASSERT_THROW(s_list.remove(10), std::out_of_range);
+    ASSERT_LIST_THROW(s_list.get_first(), std::out_of_range);
+    ASSERT_LIST_THROW(s_list.get_last(), std::out_of_range);
+    ASSERT_LIST_THROW(s_list.get_node(5), std::out_of_range);
+    ASSERT_LIST_THROW(s_list.pop_front(), std::out_of_range);
+    ASSERT_LIST_THROW(s_list.pop_back(), std::out_of_range);
+    ASSERT_LIST_THROW(s_list.remove(10), std::out_of_range);
 
     SinglyNode s_node("InsertedTestNode"); // Add a node to the list
     SinglyNode s_node2("InsertedTestNode2");
 
     // Test insert with an out-of-range index on an emtpy list
-    ASSERT_THROW(s_list.insert(100, s_node), std::out_of_range);
+    ASSERT_LIST_THROW(s_list.insert(100, s_node), std::out_of_range);
 
     // Fill the list with some random elements
     s_list.push_back(*new SinglyNode("another node1"));
@@ -130,10 +153,10 @@ TEST(SinglyLinkedListTests, OutOfRangeTests)
     s_list.push_back(*new SinglyNode("another node3"));
 
     // Test insert with an out-of-range index on an emtpy list
-    ASSERT_THROW(s_list.insert(10, s_node2), std::out_of_range);
+    ASSERT_LIST_THROW(s_list.insert(10, s_node2), std::out_of_range);
 
     // // Test get_node with an out-of-range index
-    ASSERT_THROW(s_list.get_node(50), std::out_of_range);
+    ASSERT_LIST_THROW(s_list.get_node(50), std::out_of_range);
 }
 
 TEST(SinglyLinkedListTests, AddDuplicateNodeTests)
@@ -144,13 +167,13 @@ TEST(SinglyLinkedListTests, AddDuplicateNodeTests)
     s_list.push_back(existing_node);
 
     // Test push_back
-    ASSERT_THROW(s_list.push_back(existing_node), std::runtime_error);
+    ASSERT_LIST_THROW(s_list.push_back(existing_node), std::runtime_error);
 
     // Test push_front
-    ASSERT_THROW(s_list.push_front(existing_node), std::runtime_error);
+    ASSERT_LIST_THROW(s_list.push_front(existing_node), std::runtime_error);
 
     // Test insert
-    ASSERT_THROW(s_list.insert(0, existing_node), std::runtime_error);
+    ASSERT_LIST_THROW(s_list.insert(0, existing_node), std::runtime_error);
 }
 
 TEST(SinglyLinkedListTests, PopFrontTest)
@@ -206,7 +229,7 @@ TEST(SinglyLinkedListTests, RemoveByIndexTest)
     s_list.push_back(third_node);
     s_list.push_front(first_node);
 
-    ASSERT_THROW(s_list.remove(10), std::out_of_range);
+    ASSERT_LIST_THROW(s_list.remove(10), std::out_of_range);
 
     SinglyNode &removed = s_list.remove(1);
 
@@ -231,7 +254,7 @@ TEST(SinglyLinkedListTests, RemoveByNodeTest)
     s_list.push_front(first_node);
 
     // Try to remove a nonexistent node from the list
-    ASSERT_THROW(s_list.remove(nonexistent_node), std::logic_error);
+    ASSERT_LIST_THROW(s_list.remove(nonexistent_node), std::logic_error);
 
     s_list.remove(second_node);
 
@@ -242,7 +265,671 @@ TEST(SinglyLinkedListTests, SortByTest)
 {
     SinglyLinkedList s_list;
 
-    ASSERT_THROW(s_list.sort_by(), std::logic_error);
+    ASSERT_LIST_THROW(s_list.sort_by(), std::logic_error);
+}
+
+TEST(SinglyLinkedListTests, IteratorTest)
+{
+    SinglyLinkedList s_list;
+
+    ASSERT_EQ(s_list.begin(), s_list.end());
+
+    SinglyNode first_node = SinglyNode("0");
+    SinglyNode second_node = SinglyNode("1");
+    SinglyNode third_node = SinglyNode("2");
+
+    s_list.push_back(first_node);
+    s_list.push_back(second_node);
+    s_list.push_back(third_node);
+
+    std::string joined;
+    for (SinglyNode &node : s_list)
+        joined += node.get_data();
+
+    ASSERT_EQ(joined, "012");
+    ASSERT_EQ(&*s_list.begin(), &first_node); // Iterators yield the nodes themselves, not copies
+    ASSERT_EQ(std::distance(s_list.begin(), s_list.end()), 3);
+}
+
+TEST(SinglyLinkedListTests, ViewsTest)
+{
+    SinglyLinkedList s_list;
+    SinglyNode nodes[] = {SinglyNode("0"), SinglyNode("1"), SinglyNode("2"), SinglyNode("3"), SinglyNode("4"), SinglyNode("5"), SinglyNode("6")};
+
+    for (SinglyNode &node : nodes)
+        s_list.push_back(node);
+
+    auto is_even = [](const SinglyNode &node)
+    { return node.get_index() % 2 == 0; };
+    auto data_of = [](const SinglyNode &node)
+    { return node.get_data(); };
+
+    // filter + take: [0, 2, 4, 6] -> [0, 2, 4]
+    std::string joined;
+    for (SinglyNode &node : s_list | views::filter(is_even) | views::take(3))
+        joined += node.get_data();
+    ASSERT_EQ(joined, "024");
+
+    // drop + transform (function-call form)
+    joined.clear();
+    for (const std::string &data : views::transform(views::drop(s_list, 5), data_of))
+        joined += data;
+    ASSERT_EQ(joined, "56");
+
+    // take/drop beyond the size of the list
+    ASSERT_EQ(std::distance((s_list | views::take(100)).begin(), (s_list | views::take(100)).end()), 7);
+    auto dropped_all = s_list | views::drop(100);
+    ASSERT_EQ(dropped_all.begin(), dropped_all.end());
+
+    // chunk: [0 1 2] [3 4 5] [6]
+    std::vector<std::string> chunks;
+    for (auto chunk : s_list | views::chunk(3))
+    {
+        std::string chunk_data;
+        for (SinglyNode &node : chunk)
+            chunk_data += node.get_data();
+        chunks.push_back(chunk_data);
+    }
+    ASSERT_EQ(chunks, (std::vector<std::string>{"012", "345", "6"}));
+    ASSERT_LIST_THROW(s_list | views::chunk(0), std::invalid_argument);
+
+    // zip stops at the shorter range
+    int pairs = 0;
+    for (auto pair : views::zip(s_list, s_list | views::filter(is_even)))
+    {
+        ASSERT_EQ(pair.first.get_index() * 2, pair.second.get_index());
+        pairs++;
+    }
+    ASSERT_EQ(pairs, 4);
+
+    // Views are non-owning: modifying through a view modifies the node in the list
+    for (SinglyNode &node : s_list | views::filter(is_even))
+        node.set_data("even");
+    ASSERT_EQ(nodes[4].get_data(), "even");
+    ASSERT_EQ(nodes[5].get_data(), "5");
+}
+
+TEST(SinglyLinkedListTests, TryMethodsTest)
+{
+    SinglyLinkedList s_list;
+
+    SinglyNode first_node = SinglyNode("0");
+    SinglyNode second_node = SinglyNode("1");
+    SinglyNode third_node = SinglyNode("2");
+    SinglyNode nonexistent_node = SinglyNode("100"); // not added
+
+    // Misses on an empty list
+    ASSERT_EQ(s_list.try_get_node(0), nullptr);
+    ASSERT_EQ(s_list.try_remove(0), nullptr);
+    ASSERT_EQ(s_list.try_remove(first_node), false);
+    ASSERT_EQ(s_list.try_index_of(first_node), INVALID_INDEX);
+
+    s_list.push_back(first_node);
+    s_list.push_back(second_node);
+    s_list.push_back(third_node);
+
+    // Hits
+    ASSERT_EQ(s_list.try_get_node(1), &second_node);
+    ASSERT_EQ(s_list.try_index_of(third_node), 2);
+
+    // Misses on a filled list
+    ASSERT_EQ(s_list.try_get_node(3), nullptr);
+    ASSERT_EQ(s_list.try_get_node(-1), nullptr);
+    ASSERT_EQ(s_list.try_remove(10), nullptr);
+    ASSERT_EQ(s_list.try_remove(nonexistent_node), false);
+    ASSERT_EQ(s_list.try_index_of(nonexistent_node), INVALID_INDEX);
+    ASSERT_EQ(s_list.size(), 3);
+
+    // Remove the last node by index, then the first node by reference
+    ASSERT_EQ(s_list.try_remove(2), &third_node);
+    ASSERT_EQ(&s_list.get_last(), &second_node);
+    ASSERT_EQ(third_node.get_next_node_ptr(), nullptr);
+
+    ASSERT_EQ(s_list.try_remove(first_node), true);
+    ASSERT_EQ(s_list.size(), 1);
+    ASSERT_EQ(&s_list.get_first(), &second_node);
+    ASSERT_EQ(second_node.get_index(), 0);
+
+    ASSERT_EQ(s_list.try_remove(0), &second_node);
+    ASSERT_EQ(s_list.is_empty(), true);
+
+    // The list is still usable after removing all nodes
+    s_list.push_back(third_node);
+    ASSERT_EQ(&s_list.get_first(), &s_list.get_last());
+}
+
+TEST(SinglyLinkedListTests, SequentialAccessTest)
+{
+    SinglyLinkedList s_list;
+    SinglyNode nodes[] = {SinglyNode("0"), SinglyNode("1"), SinglyNode("2"), SinglyNode("3"), SinglyNode("4")};
+
+    for (SinglyNode &node : nodes)
+        s_list.push_back(node);
+
+    // Forwards, backwards and repeated lookups (served from the cached finger where possible)
+    for (int i = 0; i < 5; i++)
+        ASSERT_EQ(&s_list.get_node(i), &nodes[i]);
+    for (int i = 4; i >= 0; i--)
+        ASSERT_EQ(&s_list.get_node(i), &nodes[i]);
+    ASSERT_EQ(&s_list.get_node(2), &nodes[2]);
+    ASSERT_EQ(&s_list.get_node(2), &nodes[2]);
+
+    // The finger must not survive mutations of the list
+    ASSERT_EQ(&s_list.get_node(3), &nodes[3]);
+    s_list.remove(nodes[3]);
+    ASSERT_EQ(&s_list.get_node(3), &nodes[4]);
+    ASSERT_EQ(s_list.try_get_node(4), nullptr);
+
+    s_list.pop_front();
+    ASSERT_EQ(&s_list.get_node(0), &nodes[1]);
+    ASSERT_EQ(&s_list.get_node(2), &nodes[4]);
+}
+
+TEST(SinglyLinkedListTests, CursorTest)
+{
+    SinglyLinkedList s_list;
+
+    SinglyNode first_node = SinglyNode("0");
+    SinglyNode second_node = SinglyNode("1");
+    SinglyNode third_node = SinglyNode("2");
+    SinglyNode inserted_node = SinglyNode("inserted");
+    SinglyNode appended_node = SinglyNode("appended");
+
+    s_list.push_back(first_node);
+    s_list.push_back(second_node);
+    s_list.push_back(third_node);
+
+    ASSERT_LIST_THROW(s_list.get_cursor(3), std::out_of_range);
+
+    SinglyLinkedList::Cursor cursor = s_list.get_cursor(0);
+    ASSERT_EQ(&cursor.get(), &first_node);
+
+    // Advance and insert in the middle: [0, 1, inserted, 2]
+    ASSERT_EQ(cursor.advance(), true);
+    ASSERT_EQ(cursor.index(), 1);
+    cursor.insert_after(inserted_node);
+    ASSERT_LIST_THROW(cursor.insert_after(inserted_node), std::runtime_error);
+    ASSERT_LIST_THROW(cursor.insert_after(third_node), std::runtime_error); // The tail has no next node, but is in the list
+
+    ASSERT_EQ(&cursor.get(), &second_node);
+    ASSERT_EQ(s_list.size(), 4);
+    ASSERT_EQ(s_list.index_of(inserted_node), 2);
+    ASSERT_EQ(s_list.index_of(third_node), 3);
+
+    // Erase after: [0, 1, 2]
+    ASSERT_EQ(&cursor.erase_after(), &inserted_node);
+    ASSERT_EQ(s_list.size(), 3);
+    ASSERT_EQ(&s_list.get_node(2), &third_node);
+
+    // Insert and erase at the tail: the tail pointer follows
+    ASSERT_EQ(cursor.advance(), true);
+    cursor.insert_after(appended_node);
+    ASSERT_EQ(&s_list.get_last(), &appended_node);
+    ASSERT_EQ(s_list.size(), 4);
+
+    ASSERT_EQ(&cursor.erase_after(), &appended_node);
+    ASSERT_EQ(&s_list.get_last(), &third_node);
+    ASSERT_LIST_THROW(cursor.erase_after(), std::out_of_range);
+
+    // Moving past the end invalidates the cursor
+    ASSERT_EQ(cursor.advance(5), false);
+    ASSERT_EQ(cursor.is_valid(), false);
+    ASSERT_LIST_THROW(cursor.get(), std::out_of_range);
+}
+
+TEST(SinglyLinkedListTests, ConcurrentConstLookupTest)
+{
+    const int node_cnt = 200;
+    const int thread_cnt = 4;
+
+    std::vector<std::unique_ptr<SinglyNode>> nodes; // Declared first, so the list is destroyed before its nodes
+    SinglyLinkedList s_list;
+    for (int i = 0; i < node_cnt; i++)
+    {
+        nodes.emplace_back(new SinglyNode(std::to_string(i)));
+        s_list.push_back(*nodes.back());
+    }
+
+    // Const lookups move the shared finger; each thread walks the list in a different pattern
+    const SinglyLinkedList &const_list = s_list;
+    std::vector<int> mismatch_cnts(thread_cnt, 0);
+    std::vector<std::thread> threads;
+
+    for (int t = 0; t < thread_cnt; t++)
+        threads.emplace_back([&, t]
+                             {
+                                 for (int round = 0; round < 20; round++)
+                                 {
+                                     for (int i = 0; i < node_cnt; i++)
+                                     {
+                                         int index = (t % 2 == 0) ? i : node_cnt - 1 - i;
+                                         if (&const_list.get_node(index) != nodes[index].get() || const_list.try_get_node(index) != nodes[index].get())
+                                             mismatch_cnts[t]++;
+                                     }
+                                 } });
+
+    for (std::thread &thread : threads)
+        thread.join();
+
+    for (int mismatch_cnt : mismatch_cnts)
+        ASSERT_EQ(mismatch_cnt, 0);
+}
+
+// Returns the data of all nodes, concatenated, and checks that every node has the index of its position
+std::string joined_data(const SinglyLinkedList &s_list)
+{
+    std::string joined;
+    int expected_index = 0;
+
+    for (SinglyNode &node : s_list)
+    {
+        EXPECT_EQ(node.get_index(), expected_index++);
+        joined += node.get_data();
+    }
+
+    EXPECT_EQ(s_list.size(), expected_index);
+    return joined;
+}
+
+TEST(SinglyLinkedListTests, MergeTest)
+{
+    SinglyLinkedList s_list;
+    SinglyLinkedList other_list;
+    SinglyNode nodes[] = {SinglyNode("a"), SinglyNode("c"), SinglyNode("e"), SinglyNode("b"), SinglyNode("c"), SinglyNode("f"), SinglyNode("g")};
+
+    s_list.push_back(nodes[0]);
+    s_list.push_back(nodes[1]);
+    s_list.push_back(nodes[2]);
+    other_list.push_back(nodes[3]);
+    other_list.push_back(nodes[4]);
+    other_list.push_back(nodes[5]);
+    other_list.push_back(nodes[6]);
+
+    s_list.merge(other_list);
+
+    ASSERT_EQ(joined_data(s_list), "abccefg");
+    ASSERT_EQ(&s_list.get_node(2), &nodes[1]); // Stable: on equal data the node of this list comes first
+    ASSERT_EQ(&s_list.get_last(), &nodes[6]);
+    ASSERT_EQ(other_list.is_empty(), true);
+
+    // Merging into an empty list takes over all nodes
+    other_list.merge(s_list);
+    ASSERT_EQ(joined_data(other_list), "abccefg");
+    ASSERT_EQ(s_list.is_empty(), true);
+}
+
+TEST(SinglyLinkedListTests, UniqueTest)
+{
+    SinglyLinkedList s_list;
+    SinglyNode nodes[] = {SinglyNode("a"), SinglyNode("a"), SinglyNode("b"), SinglyNode("a"), SinglyNode("c"), SinglyNode("c"), SinglyNode("c")};
+
+    ASSERT_EQ(s_list.unique(), 0);
+
+    for (SinglyNode &node : nodes)
+        s_list.push_back(node);
+
+    ASSERT_EQ(s_list.unique(), 3);
+    ASSERT_EQ(joined_data(s_list), "abac");
+    ASSERT_EQ(&s_list.get_last(), &nodes[4]);
+    ASSERT_EQ(nodes[6].get_next_node_ptr(), nullptr);
+}
+
+TEST(SinglyLinkedListTests, ReverseTest)
+{
+    SinglyLinkedList s_list;
+    SinglyNode nodes[] = {SinglyNode("0"), SinglyNode("1"), SinglyNode("2"), SinglyNode("3")};
+
+    s_list.reverse(); // Empty list: nothing to do
+
+    for (SinglyNode &node : nodes)
+        s_list.push_back(node);
+
+    s_list.reverse();
+
+    ASSERT_EQ(joined_data(s_list), "3210");
+    ASSERT_EQ(&s_list.get_first(), &nodes[3]);
+    ASSERT_EQ(&s_list.get_last(), &nodes[0]);
+    ASSERT_EQ(nodes[0].get_next_node_ptr(), nullptr);
+}
+
+TEST(SinglyLinkedListTests, RotateTest)
+{
+    SinglyLinkedList s_list;
+    SinglyNode nodes[] = {SinglyNode("0"), SinglyNode("1"), SinglyNode("2"), SinglyNode("3"), SinglyNode("4")};
+
+    s_list.rotate(3); // Empty list: nothing to do
+
+    for (SinglyNode &node : nodes)
+        s_list.push_back(node);
+
+    s_list.rotate(2);
+    ASSERT_EQ(joined_data(s_list), "23401");
+    ASSERT_EQ(&s_list.get_last(), &nodes[1]);
+
+    s_list.rotate(-2); // Back to the start
+    ASSERT_EQ(joined_data(s_list), "01234");
+
+    s_list.rotate(5); // Full turn
+    ASSERT_EQ(joined_data(s_list), "01234");
+
+    s_list.rotate(13); // Same as 3
+    ASSERT_EQ(joined_data(s_list), "34012");
+}
+
+TEST(SinglyLinkedListTests, PartitionTest)
+{
+    SinglyLinkedList s_list;
+    SinglyNode nodes[] = {SinglyNode("1"), SinglyNode("2"), SinglyNode("3"), SinglyNode("4"), SinglyNode("5"), SinglyNode("6")};
+
+    for (SinglyNode &node : nodes)
+        s_list.push_back(node);
+
+    auto is_even = [](const SinglyNode &node)
+    { return std::stoi(node.get_data()) % 2 == 0; };
+
+    ASSERT_EQ(s_list.partition(is_even), 3);
+    ASSERT_EQ(joined_data(s_list), "246135");
+    ASSERT_EQ(&s_list.get_last(), &nodes[4]);
+
+    // All nodes or no node match: the order is unchanged
+    ASSERT_EQ(s_list.partition([](const SinglyNode &)
+                               { return true; }),
+              6);
+    ASSERT_EQ(joined_data(s_list), "246135");
+    ASSERT_EQ(s_list.partition([](const SinglyNode &)
+                               { return false; }),
+              0);
+    ASSERT_EQ(joined_data(s_list), "246135");
+    ASSERT_EQ(&s_list.get_last(), &nodes[4]);
+}
+
+#ifndef LINKEDLIST_NO_EXCEPTIONS
+TEST(SinglyLinkedListTests, PartitionThrowingPredicateTest)
+{
+    SinglyLinkedList s_list;
+    SinglyNode nodes[] = {SinglyNode("1"), SinglyNode("2"), SinglyNode("x"), SinglyNode("4"), SinglyNode("5")};
+
+    for (SinglyNode &node : nodes)
+        s_list.push_back(node);
+
+    auto is_even = [](const SinglyNode &node)
+    { return std::stoi(node.get_data()) % 2 == 0; };
+
+    // The predicate throws at "x": the nodes before it are partitioned, the list stays complete
+    ASSERT_THROW(s_list.partition(is_even), std::invalid_argument);
+    ASSERT_EQ(s_list.size(), 5);
+    ASSERT_EQ(joined_data(s_list), "21x45");
+    ASSERT_EQ(&s_list.get_last(), &nodes[4]);
+}
+#endif
+
+TEST(SinglyLinkedListTests, InternedDataTest)
+{
+    StringPool pool;
+    SinglyLinkedList s_list;
+
+    SinglyNode first_node(pool, "Alexander Hamilton");
+    SinglyNode second_node(pool, "Alexander Hamilton");
+    SinglyNode third_node(pool, "Aaron Burr");
+    SinglyNode owned_node("Alexander Hamilton"); // Not interned
+
+    // Equal strings are stored only once
+    ASSERT_EQ(pool.size(), 2);
+    ASSERT_EQ(first_node.is_interned(), true);
+    ASSERT_EQ(owned_node.is_interned(), false);
+    ASSERT_EQ(first_node.get_data_view().data(), second_node.get_data_view().data());
+
+    // Accessors and comparisons work across interned and owned data
+    ASSERT_EQ(first_node.get_data(), "Alexander Hamilton");
+    ASSERT_EQ(first_node.data_equals(second_node), true);
+    ASSERT_EQ(first_node.data_equals(third_node), false);
+    ASSERT_EQ(first_node.data_equals(owned_node), true);
+    ASSERT_EQ(first_node.compare_data(owned_node), 0);
+    ASSERT_GT(first_node.compare_data(third_node), 0);
+
+    // Equal strings of different pools are still equal
+    StringPool other_pool;
+    SinglyNode other_pool_node(other_pool, "Aaron Burr");
+    ASSERT_EQ(third_node.data_equals(other_pool_node), true);
+
+    // Interned nodes work with the list algorithms
+    s_list.push_back(first_node);
+    s_list.push_back(second_node);
+    s_list.push_back(owned_node);
+    s_list.push_back(third_node);
+    ASSERT_EQ(s_list.unique(), 2);
+    ASSERT_EQ(s_list.size(), 2);
+
+    // Changing the data switches between owned and interned data
+    first_node.set_data("George Washington");
+    ASSERT_EQ(first_node.is_interned(), false);
+    ASSERT_EQ(first_node.get_data_view(), "George Washington");
+
+    first_node.set_data(pool, "Aaron Burr");
+    ASSERT_EQ(first_node.is_interned(), true);
+    ASSERT_EQ(first_node.data_equals(third_node), true);
+    ASSERT_EQ(pool.size(), 2);
+
+    // Owned and interned data share the same storage in the node (the flags fit into the padding after the next pointer)
+    ASSERT_LE(sizeof(SinglyNode), 2 * sizeof(int) + sizeof(std::string) + 2 * sizeof(void *));
+
+    // Copies share interned data, owned data is copied
+    SinglyNode interned_copy(first_node);
+    SinglyNode owned_copy(owned_node);
+    ASSERT_EQ(interned_copy.get_data_view().data(), first_node.get_data_view().data());
+    ASSERT_NE(owned_copy.get_data_view().data(), owned_node.get_data_view().data());
+    ASSERT_EQ(owned_copy.data_equals(owned_node), true);
+    ASSERT_EQ(owned_copy.get_next_node_ptr(), nullptr);
+
+    owned_copy = third_node;
+    ASSERT_EQ(owned_copy.is_interned(), true);
+    ASSERT_EQ(owned_copy.data_equals(third_node), true);
+    ASSERT_EQ(owned_node.get_data(), "Alexander Hamilton");
+}
+
+TEST(SinglyLinkedListTests, ShardedPushBackTest)
+{
+    const int thread_cnt = 8;
+    const int nodes_per_thread = 1000;
+
+    ShardedSinglyLinkedList sharded_list(4);
+    ASSERT_EQ(sharded_list.is_empty(), true);
+
+    std::vector<std::unique_ptr<SinglyNode>> nodes;
+    for (int i = 0; i < thread_cnt * nodes_per_thread; i++)
+        nodes.emplace_back(new SinglyNode(std::to_string(i)));
+
+    // Every thread appends its own block of nodes concurrently
+    std::vector<std::thread> threads;
+    for (int t = 0; t < thread_cnt; t++)
+        threads.emplace_back([&, t]
+                             {
+                                 for (int i = 0; i < nodes_per_thread; i++)
+                                     sharded_list.push_back(*nodes[t * nodes_per_thread + i]); });
+
+    for (std::thread &thread : threads)
+        thread.join();
+
+    ASSERT_EQ(sharded_list.size(), thread_cnt * nodes_per_thread);
+
+    int visited_cnt = 0;
+    sharded_list.for_each([&](SinglyNode &)
+                          { visited_cnt++; });
+    ASSERT_EQ(visited_cnt, thread_cnt * nodes_per_thread);
+
+    // Drain into a list that already holds a node
+    SinglyLinkedList s_list;
+    SinglyNode existing_node("existing");
+    s_list.push_back(existing_node);
+
+    sharded_list.drain_to(s_list);
+
+    ASSERT_EQ(sharded_list.is_empty(), true);
+    ASSERT_EQ(s_list.size(), thread_cnt * nodes_per_thread + 1);
+    ASSERT_EQ(&s_list.get_first(), &existing_node);
+
+    // Every node is in the list exactly once, with a valid index, and the order of each thread is kept
+    std::set<const SinglyNode *> seen;
+    std::vector<int> last_of_thread(thread_cnt, -1);
+    int expected_index = 1;
+
+    for (SinglyNode &node : s_list | views::drop(1))
+    {
+        ASSERT_EQ(node.get_index(), expected_index++);
+        ASSERT_EQ(seen.insert(&node).second, true);
+
+        int value = std::stoi(node.get_data());
+        ASSERT_GT(value, last_of_thread[value / nodes_per_thread]);
+        last_of_thread[value / nodes_per_thread] = value;
+    }
+    ASSERT_EQ(&s_list.get_last(), s_list.try_get_node(thread_cnt * nodes_per_thread));
+}
+
+TEST(SinglyLinkedListTests, ShardedPushBackNodeInListTest)
+{
+    SinglyNode first_node("0"), second_node("1"), third_node("2");
+
+    SinglyLinkedList s_list;
+    s_list.push_back(first_node);
+    s_list.push_back(second_node);
+
+    ShardedSinglyLinkedList sharded_list(2);
+
+    // Nodes of another list are rejected, so the rest of that list is not cut off
+    ASSERT_LIST_THROW(sharded_list.push_back(first_node), std::runtime_error);
+    ASSERT_EQ(s_list.size(), 2);
+    ASSERT_EQ(first_node.get_next_node_ptr(), &second_node);
+
+    // A node can be pushed only once
+    sharded_list.push_back(third_node);
+    ASSERT_LIST_THROW(sharded_list.push_back(third_node), std::runtime_error);
+    ASSERT_EQ(sharded_list.size(), 1);
+
+    // Drained nodes are in the target list; removed from it, they can be pushed again
+    sharded_list.drain_to(s_list);
+    ASSERT_EQ(joined_data(s_list), "012");
+    ASSERT_LIST_THROW(sharded_list.push_back(third_node), std::runtime_error);
+
+    s_list.pop_back();
+    sharded_list.push_back(third_node);
+    ASSERT_EQ(sharded_list.size(), 1);
+}
+
+TEST(SinglyLinkedListTests, SelfOrganizingFindTest)
+{
+    SinglyLinkedList s_list;
+    SinglyNode nodes[] = {SinglyNode("a"), SinglyNode("b"), SinglyNode("c"), SinglyNode("d"), SinglyNode("e")};
+
+    for (SinglyNode &node : nodes)
+        s_list.push_back(node);
+
+    // Default: the order is kept
+    ASSERT_EQ(s_list.get_self_organizing_policy(), SelfOrganizingPolicy::None);
+    ASSERT_EQ(s_list.find("d"), &nodes[3]);
+    ASSERT_EQ(s_list.find("x"), nullptr);
+    ASSERT_EQ(joined_data(s_list), "abcde");
+
+    s_list.set_self_organizing_policy(SelfOrganizingPolicy::Transpose);
+    ASSERT_EQ(s_list.find("d"), &nodes[3]);
+    ASSERT_EQ(joined_data(s_list), "abdce");
+    ASSERT_EQ(s_list.find("b"), &nodes[1]);
+    ASSERT_EQ(joined_data(s_list), "badce");
+
+    s_list.set_self_organizing_policy(SelfOrganizingPolicy::MoveToFront);
+    ASSERT_EQ(s_list.find("e"), &nodes[4]);
+    ASSERT_EQ(joined_data(s_list), "ebadc");
+    ASSERT_EQ(&s_list.get_last(), &nodes[2]);
+    ASSERT_EQ(s_list.find("e"), &nodes[4]); // Already the head node
+    ASSERT_EQ(joined_data(s_list), "ebadc");
+}
+
+TEST(SinglyLinkedListTests, SelfOrganizingCountTest)
+{
+    SinglyLinkedList s_list;
+    SinglyNode nodes[] = {SinglyNode("a"), SinglyNode("b"), SinglyNode("c"), SinglyNode("d")};
+
+    for (SinglyNode &node : nodes)
+        s_list.push_back(node);
+
+    s_list.set_self_organizing_policy(SelfOrganizingPolicy::Count);
+
+    s_list.find("c"); // c:1
+    ASSERT_EQ(joined_data(s_list), "cabd");
+    s_list.find("d"); // c:1 d:1
+    ASSERT_EQ(joined_data(s_list), "cdab");
+    s_list.find("d"); // d:2 c:1
+    ASSERT_EQ(joined_data(s_list), "dcab");
+    s_list.find("b"); // d:2 c:1 b:1
+    ASSERT_EQ(joined_data(s_list), "dcba");
+    s_list.find("a"); // d:2 c:1 b:1 a:1
+    ASSERT_EQ(joined_data(s_list), "dcba");
+    ASSERT_EQ(&s_list.get_last(), &nodes[0]);
+
+    ASSERT_EQ(nodes[3].get_access_count(), 2);
+    ASSERT_EQ(nodes[2].get_access_count(), 1);
+}
+
+TEST(SinglyLinkedListTests, MultiGetTest)
+{
+    SinglyLinkedList s_list;
+    SinglyNode nodes[] = {SinglyNode("0"), SinglyNode("1"), SinglyNode("2"), SinglyNode("3"), SinglyNode("4")};
+
+    ASSERT_EQ(s_list.multi_get({0, 1}), (std::vector<SinglyNode *>{nullptr, nullptr}));
+
+    for (SinglyNode &node : nodes)
+        s_list.push_back(node);
+
+    // Unsorted, duplicate and out of range indexes; results are in request order
+    std::vector<SinglyNode *> results = s_list.multi_get({4, 0, 2, 7, 2, -1});
+    ASSERT_EQ(results, (std::vector<SinglyNode *>{&nodes[4], &nodes[0], &nodes[2], nullptr, &nodes[2], nullptr}));
+}
+
+TEST(SinglyLinkedListTests, MultiRemoveTest)
+{
+    SinglyLinkedList s_list;
+    SinglyNode nodes[] = {SinglyNode("0"), SinglyNode("1"), SinglyNode("2"), SinglyNode("3"), SinglyNode("4"), SinglyNode("5")};
+
+    for (SinglyNode &node : nodes)
+        s_list.push_back(node);
+
+    s_list.get_node(3); // Sets the finger to a node that is removed below
+
+    std::vector<SinglyNode *> removed = s_list.multi_remove({5, 3, 1, 3, 9});
+    ASSERT_EQ(removed, (std::vector<SinglyNode *>{&nodes[5], &nodes[3], &nodes[1], &nodes[3], nullptr}));
+
+    ASSERT_EQ(joined_data(s_list), "024");
+    ASSERT_EQ(&s_list.get_last(), &nodes[4]);
+    ASSERT_EQ(&s_list.get_node(2), &nodes[4]);
+    ASSERT_EQ(nodes[3].get_next_node_ptr(), nullptr);
+
+    // Remove the head and everything else
+    removed = s_list.multi_remove({0, 1, 2});
+    ASSERT_EQ(removed, (std::vector<SinglyNode *>{&nodes[0], &nodes[2], &nodes[4]}));
+    ASSERT_EQ(s_list.is_empty(), true);
+    ASSERT_EQ(s_list.size(), 0);
+}
+
+TEST(SinglyLinkedListTests, MultiGetInterleavedTest)
+{
+    SinglyLinkedList first_list;
+    SinglyLinkedList second_list;
+    SinglyNode first_nodes[] = {SinglyNode("a0"), SinglyNode("a1"), SinglyNode("a2")};
+    SinglyNode second_nodes[] = {SinglyNode("b0"), SinglyNode("b1"), SinglyNode("b2"), SinglyNode("b3"), SinglyNode("b4")};
+
+    for (SinglyNode &node : first_nodes)
+        first_list.push_back(node);
+    for (SinglyNode &node : second_nodes)
+        second_list.push_back(node);
+
+    std::vector<SinglyNode *> results = SinglyLinkedList::multi_get_interleaved({{&second_list, 4},
+                                                                                 {&first_list, 2},
+                                                                                 {&second_list, 0},
+                                                                                 {&first_list, 3},
+                                                                                 {&first_list, 0},
+                                                                                 {&second_list, 4},
+                                                                                 {nullptr, 0}});
+
+    ASSERT_EQ(results, (std::vector<SinglyNode *>{&second_nodes[4], &first_nodes[2], &second_nodes[0], nullptr, &first_nodes[0], &second_nodes[4], nullptr}));
 }
 
 void print_example_list()
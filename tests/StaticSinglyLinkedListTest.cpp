@@ -0,0 +1,174 @@
+#include <gtest/gtest.h>
+#include <memory>
+#include <string>
+#include "static/StaticSinglyLinkedList.h"
+#include "LinkedListTestMacros.h"
+
+// Builds [0, 5, 1] (after removing 2) at compile time and returns the sum of all values
+constexpr int constexpr_list_sum()
+{
+    StaticSinglyLinkedList<int, 4> s_list;
+
+    s_list.push_back(1);
+    s_list.push_back(2);
+    s_list.push_front(0);
+    s_list.insert(1, 5);
+    s_list.pop_back();
+
+    int sum = 0;
+    for (int value : s_list)
+        sum += value;
+
+    return sum;
+}
+
+// Fills the list, empties it and fills it again to reuse the slots of the free list
+constexpr int constexpr_slot_reuse()
+{
+    StaticSinglyLinkedList<int, 3> s_list;
+
+    for (int round = 0; round < 3; round++)
+    {
+        for (int i = 0; i < s_list.capacity(); i++)
+            s_list.push_back(round * 10 + i);
+
+        if (round < 2)
+            s_list.clear();
+    }
+
+    return s_list.remove(1) + s_list.get_first() + s_list.get_last(); // 21 + 20 + 22
+}
+
+static_assert(constexpr_list_sum() == 6, "List operations must be usable in constant expressions");
+static_assert(constexpr_slot_reuse() == 63, "Freed slots must be reused");
+static_assert(StaticSinglyLinkedList<int, 8>::capacity() == 8, "Capacity is known at compile time");
+
+TEST(StaticSinglyLinkedListTests, PushAndGetTest)
+{
+    StaticSinglyLinkedList<std::string, 5> s_list;
+
+    ASSERT_EQ(s_list.is_empty(), true);
+
+    s_list.push_back("1");
+    s_list.push_front("0");
+    s_list.push_back("3");
+    s_list.insert(2, "2");
+    s_list.insert(4, "4"); // index == size() appends
+
+    ASSERT_EQ(s_list.size(), 5);
+    ASSERT_EQ(s_list.is_full(), true);
+    ASSERT_EQ(s_list.get_first(), "0");
+    ASSERT_EQ(s_list.get_last(), "4");
+
+    std::string joined;
+    for (const std::string &value : s_list)
+        joined += value;
+    ASSERT_EQ(joined, "01234");
+
+    for (int i = 0; i < s_list.size(); i++)
+        ASSERT_EQ(s_list.get(i), std::to_string(i));
+
+    s_list.get(2) = "two"; // Values are modified in place
+    ASSERT_EQ(*s_list.try_get(2), "two");
+    ASSERT_EQ(s_list.try_get(5), nullptr);
+}
+
+TEST(StaticSinglyLinkedListTests, PopAndRemoveTest)
+{
+    StaticSinglyLinkedList<std::string, 4> s_list;
+
+    s_list.push_back("0");
+    s_list.push_back("1");
+    s_list.push_back("2");
+    s_list.push_back("3");
+
+    ASSERT_EQ(s_list.remove(3), "3");
+    ASSERT_EQ(s_list.get_last(), "2");
+    ASSERT_EQ(s_list.remove(1), "1");
+    ASSERT_EQ(s_list.pop_back(), "2");
+    ASSERT_EQ(s_list.pop_front(), "0");
+    ASSERT_EQ(s_list.is_empty(), true);
+
+    // All slots are free again
+    for (int i = 0; i < s_list.capacity(); i++)
+        s_list.push_front(std::to_string(i));
+
+    ASSERT_EQ(s_list.get_first(), "3");
+    ASSERT_EQ(s_list.get_last(), "0");
+}
+
+TEST(StaticSinglyLinkedListTests, CapacityAndRangeTests)
+{
+    StaticSinglyLinkedList<int, 2> s_list;
+
+    ASSERT_LIST_THROW(s_list.get_first(), std::out_of_range);
+    ASSERT_LIST_THROW(s_list.get_last(), std::out_of_range);
+    ASSERT_LIST_THROW(s_list.pop_front(), std::out_of_range);
+    ASSERT_LIST_THROW(s_list.pop_back(), std::out_of_range);
+    ASSERT_LIST_THROW(s_list.remove(0), std::out_of_range);
+    ASSERT_LIST_THROW(s_list.insert(1, 0), std::out_of_range);
+
+    s_list.push_back(0);
+    s_list.push_back(1);
+
+    ASSERT_LIST_THROW(s_list.push_back(2), std::length_error);
+    ASSERT_LIST_THROW(s_list.insert(1, 2), std::length_error);
+    ASSERT_LIST_THROW(s_list.get(2), std::out_of_range);
+    ASSERT_EQ(s_list.size(), 2);
+}
+
+TEST(StaticSinglyLinkedListTests, ReleaseValuesTest)
+{
+    auto shared = std::make_shared<int>(42);
+    StaticSinglyLinkedList<std::shared_ptr<int>, 4> s_list;
+
+    s_list.push_back(shared);
+    s_list.push_back(shared);
+    s_list.push_back(shared);
+    ASSERT_EQ(shared.use_count(), 4);
+
+    // Removed values are moved out and their slots are reset
+    std::shared_ptr<int> popped = s_list.pop_front();
+    ASSERT_EQ(shared.use_count(), 4);
+    popped.reset();
+    ASSERT_EQ(shared.use_count(), 3);
+
+    s_list.remove(1);
+    ASSERT_EQ(shared.use_count(), 2);
+
+    s_list.clear();
+    ASSERT_EQ(shared.use_count(), 1);
+}
+
+TEST(StaticSinglyLinkedListTests, MoveOnlyValuesTest)
+{
+    StaticSinglyLinkedList<std::unique_ptr<std::string>, 3> s_list;
+
+    // The rvalue overloads move the values in ...
+    s_list.push_back(std::make_unique<std::string>("b"));
+    s_list.push_front(std::make_unique<std::string>("a"));
+    s_list.insert(2, std::make_unique<std::string>("c"));
+
+    ASSERT_EQ(*s_list.get(0), "a");
+    ASSERT_EQ(*s_list.get_last(), "c");
+
+    // ... and pop and remove move them out again
+    std::unique_ptr<std::string> removed = s_list.remove(1);
+    ASSERT_EQ(*removed, "b");
+    ASSERT_EQ(*s_list.pop_back(), "c");
+    ASSERT_EQ(*s_list.pop_front(), "a");
+    ASSERT_EQ(s_list.is_empty(), true);
+
+    // No copy of a long string is made on the way in
+    std::string long_data(100, 'x');
+    const char *buffer = long_data.data();
+    StaticSinglyLinkedList<std::string, 2> str_list;
+    str_list.push_back(std::move(long_data));
+    ASSERT_EQ(str_list.get_first().data(), buffer);
+}
+
+int main(int argc, char **argv)
+{
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
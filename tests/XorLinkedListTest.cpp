@@ -0,0 +1,122 @@
+#include <gtest/gtest.h>
+#include <iterator>
+#include "xor/XorLinkedList.h"
+#include "xor/XorNode.h"
+#include "LinkedListTestMacros.h"
+
+// Returns the data of all nodes between 'first' and 'last', concatenated
+std::string join(XorLinkedList::Iterator first, XorLinkedList::Iterator last)
+{
+    std::string joined;
+    for (; first != last; ++first)
+        joined += first->get_data();
+
+    return joined;
+}
+
+TEST(XorLinkedListTests, PushTest)
+{
+    XorLinkedList x_list;
+
+    ASSERT_EQ(x_list.is_empty(), true);
+
+    x_list.push_back("2");
+    x_list.push_front("1");
+    x_list.push_back("3");
+    x_list.push_front("0");
+
+    ASSERT_EQ(x_list.is_empty(), false);
+    ASSERT_EQ(x_list.size(), 4);
+    ASSERT_EQ(x_list.get_first().get_data(), "0");
+    ASSERT_EQ(x_list.get_last().get_data(), "3");
+}
+
+TEST(XorLinkedListTests, IterationTest)
+{
+    XorLinkedList x_list;
+
+    ASSERT_EQ(x_list.begin(), x_list.end());
+    ASSERT_EQ(x_list.rbegin(), x_list.rend());
+
+    for (const char *data : {"0", "1", "2", "3", "4"})
+        x_list.push_back(data);
+
+    // Forwards and backwards
+    ASSERT_EQ(join(x_list.begin(), x_list.end()), "01234");
+    ASSERT_EQ(join(x_list.rbegin(), x_list.rend()), "43210");
+
+    // Change direction in the middle of the list
+    XorLinkedList::Iterator it = x_list.begin();
+    std::advance(it, 3);
+    ASSERT_EQ(it->get_data(), "3");
+    --it;
+    ASSERT_EQ(it->get_data(), "2");
+
+    // Decrementing end() yields the tail node
+    ASSERT_EQ(std::prev(x_list.end())->get_data(), "4");
+
+    std::string joined;
+    for (XorNode &node : x_list)
+        joined += node.get_data();
+    ASSERT_EQ(joined, "01234");
+}
+
+TEST(XorLinkedListTests, PopTest)
+{
+    XorLinkedList x_list;
+
+    x_list.push_back("0");
+    x_list.push_back("1");
+    x_list.push_back("2");
+
+    ASSERT_EQ(x_list.pop_front(), "0");
+    ASSERT_EQ(x_list.pop_back(), "2");
+    ASSERT_EQ(x_list.size(), 1);
+    ASSERT_EQ(&x_list.get_first(), &x_list.get_last());
+
+    ASSERT_EQ(x_list.pop_back(), "1");
+    ASSERT_EQ(x_list.is_empty(), true);
+    ASSERT_EQ(x_list.begin(), x_list.end());
+
+    // The list is still usable after removing all nodes
+    x_list.push_front("3");
+    x_list.push_front("4");
+    ASSERT_EQ(join(x_list.rbegin(), x_list.rend()), "34");
+}
+
+TEST(XorLinkedListTests, NodeReuseTest)
+{
+    XorLinkedList x_list;
+
+    for (int i = 0; i < 1000; i++)
+        x_list.push_back(std::to_string(i));
+
+    std::size_t allocated = x_list.allocated_bytes();
+
+    // Removed nodes release their slots, so a refill does not allocate again
+    x_list.clear();
+    ASSERT_EQ(x_list.size(), 0);
+
+    for (int i = 0; i < 1000; i++)
+        x_list.push_front(std::to_string(i));
+
+    ASSERT_EQ(x_list.allocated_bytes(), allocated);
+    ASSERT_EQ(x_list.get_first().get_data(), "999");
+    ASSERT_EQ(x_list.get_last().get_data(), "0");
+}
+
+TEST(XorLinkedListTests, OutOfRangeTests)
+{
+    XorLinkedList x_list;
+
+    ASSERT_LIST_THROW(x_list.get_first(), std::out_of_range);
+    ASSERT_LIST_THROW(x_list.get_last(), std::out_of_range);
+    ASSERT_LIST_THROW(x_list.pop_front(), std::out_of_range);
+    ASSERT_LIST_THROW(x_list.pop_back(), std::out_of_range);
+}
+
+int main(int argc, char **argv)
+{
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}